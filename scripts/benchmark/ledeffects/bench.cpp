@@ -0,0 +1,81 @@
+// Host micro-benchmark of the led effects, which are evaluated in the timer interrupt (every 3 ms per led).
+// Time in the interrupt delays the knx uart handling, so the cost per value() call matters.
+//
+// Build and run from the root of the repository:
+//   g++ -O2 -std=gnu++17 -Iscripts/benchmark/ledeffects/shim -Isrc scripts/benchmark/ledeffects/bench.cpp src/OpenKNX/Led/Effects/*.cpp -o /tmp/ledbench && /tmp/ledbench
+//   (add -DOPENKNX_LEDEFFECT_GAMMA for the gamma corrected pulse)
+//
+// The host has a fpu, so the legacy sin() pulse is much cheaper here than on the SAMD21 (soft-float in the interrupt).
+// The relation of the effects and the absence of float calls are what matters.
+#include "OpenKNX/Led/Effects/Blink.h"
+#include "OpenKNX/Led/Effects/Error.h"
+#include "OpenKNX/Led/Effects/Pulse.h"
+#include <chrono>
+#include <cstdio>
+
+static uint32_t benchNow = 1;
+
+uint32_t millis()
+{
+    return benchNow;
+}
+
+uint32_t micros()
+{
+    return benchNow * 1000;
+}
+
+// the pulse before the waveform tables (double math and sin() in the interrupt)
+class LegacyPulse : public OpenKNX::Led::Effects::Base
+{
+  public:
+    uint16_t _frequency = OPENKNX_LEDEFFECT_PULSE_FREQ;
+    uint8_t value() override
+    {
+        if (_lastMillis == 0) _lastMillis = millis();
+        constexpr uint8_t refval = 255 - OPENKNX_LEDEFFECT_PULSE_MIN;
+        return (0.5 * (1 + sin(PI * ((millis() - _lastMillis) % (_frequency * 2)) / 1000.0)) * refval) + OPENKNX_LEDEFFECT_PULSE_MIN;
+    }
+};
+
+static volatile uint32_t sink = 0;
+
+static void measure(const char *name, OpenKNX::Led::Effects::Base &effect)
+{
+    constexpr uint32_t calls = 10000000;
+    benchNow = 1;
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < calls; i++)
+    {
+        // the timer interrupt runs every 3 ms
+        benchNow += 3;
+        sum += effect.value();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    sink = sum;
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / calls;
+    printf("%-14s %8.2f ns/call  (checksum %u)\n", name, ns, sum);
+}
+
+int main()
+{
+    LegacyPulse legacy;
+    OpenKNX::Led::Effects::Pulse pulse;
+    OpenKNX::Led::Effects::Blink blink;
+    OpenKNX::Led::Effects::Error error(3);
+
+    measure("Pulse (sin)", legacy);
+    measure("Pulse (table)", pulse);
+    measure("Blink", blink);
+    measure("Error", error);
+
+    // the table must follow the legacy curve (max difference in brightness steps)
+    LegacyPulse reference;
+    OpenKNX::Led::Effects::Pulse table;
+    int maxDiff = 0;
+    for (benchNow = 1; benchNow < 4 * OPENKNX_LEDEFFECT_PULSE_FREQ; benchNow++)
+        maxDiff = std::max(maxDiff, std::abs((int)reference.value() - (int)table.value()));
+    printf("max deviation from sin(): %d (higher with OPENKNX_LEDEFFECT_GAMMA)\n", maxDiff);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+// Minimal Arduino replacement to build the led effects on the host (see ../bench.cpp)
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#ifndef PI
+    #define PI 3.1415926535897932384626433832795
+#endif
+using std::max;
+using std::min;
+
+uint32_t millis();
+uint32_t micros();
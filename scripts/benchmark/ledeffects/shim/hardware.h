@@ -0,0 +1,2 @@
+#pragma once
+// empty - the effects do not need the hardware or product definitions
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Execute a console command on an OpenKNX device via the diagnose ko and print
+the complete answer (framed protocol, see src/OpenKNX/DiagnoseProtocol.h).
+No USB connection is needed, only a KNX/IP interface or router.
+
+Usage:
+    diagnose.py --ga <diagnose-ga> [--gateway <ip>] [--route] <command...>
+
+Example:
+    diagnose.py --gateway 192.168.1.10 --ga 31/7/1 runtime
+
+Requires xknx (pip install xknx).
+"""
+import argparse
+import asyncio
+import random
+import sys
+
+from xknx import XKNX
+from xknx.dpt import DPTArray
+from xknx.io import ConnectionConfig, ConnectionType
+from xknx.telegram import GroupAddress, Telegram
+from xknx.telegram.apci import GroupValueWrite
+
+FRAME_SIZE = 14
+HEADER_SIZE = 3
+PAYLOAD_SIZE = FRAME_SIZE - HEADER_SIZE
+
+REQUEST = 0x01
+REQUEST_END = 0x02
+RESPONSE = 0x03
+RESPONSE_END = 0x04
+RESEND = 0x05
+ABORT = 0x06
+RESPONSE_TRUNCATED = 0x07
+
+
+def build_requests(session, command):
+    data = command.encode("latin-1")
+    chunks = [data[i:i + PAYLOAD_SIZE] for i in range(0, len(data), PAYLOAD_SIZE)] or [b""]
+    frames = []
+    for sequence, chunk in enumerate(chunks):
+        type = REQUEST_END if sequence == len(chunks) - 1 else REQUEST
+        frames.append(bytes([type, session, sequence]) + chunk.ljust(PAYLOAD_SIZE, b"\0"))
+    return frames
+
+
+class Client:
+    def __init__(self, xknx, ga, timeout):
+        self.xknx = xknx
+        self.ga = GroupAddress(ga)
+        self.timeout = timeout
+        self.session = random.randint(0, 255)
+        self.fragments = {}
+        self.last = None
+        self.truncated = False
+        self.frames = asyncio.Queue()
+
+    def received(self, telegram):
+        if telegram.destination_address != self.ga or not isinstance(telegram.payload, GroupValueWrite):
+            return
+        value = bytes(telegram.payload.value.value)
+        if len(value) == FRAME_SIZE and value[0] in (RESPONSE, RESPONSE_END, RESPONSE_TRUNCATED, ABORT) and value[1] == self.session:
+            self.frames.put_nowait(value)
+
+    async def send(self, frame):
+        await self.xknx.telegrams.put(Telegram(destination_address=self.ga, payload=GroupValueWrite(DPTArray(frame))))
+
+    def missing(self):
+        end = self.last if self.last is not None else max(self.fragments, default=-1) + 1
+        for sequence in range(end):
+            if sequence not in self.fragments:
+                return sequence
+        return None
+
+    async def execute(self, command, retries=3):
+        for frame in build_requests(self.session, command):
+            await self.send(frame)
+
+        while True:
+            try:
+                frame = await asyncio.wait_for(self.frames.get(), self.timeout)
+            except asyncio.TimeoutError:
+                sequence = self.missing()
+                if sequence is None and self.last is None:
+                    sequence = len(self.fragments)
+                if retries == 0 or sequence is None:
+                    raise RuntimeError("no answer from device")
+                retries -= 1
+                await self.send(bytes([RESEND, self.session, sequence]).ljust(FRAME_SIZE, b"\0"))
+                continue
+
+            if frame[0] == ABORT:
+                raise RuntimeError("device aborted at sequence %d" % frame[2])
+
+            self.fragments[frame[2]] = frame[HEADER_SIZE:]
+            if frame[0] in (RESPONSE_END, RESPONSE_TRUNCATED):
+                self.last = frame[2] + 1
+                self.truncated = frame[0] == RESPONSE_TRUNCATED
+
+            if self.last is not None:
+                sequence = self.missing()
+                if sequence is None:
+                    break
+                # go back to the first lost frame
+                await self.send(bytes([RESEND, self.session, sequence]).ljust(FRAME_SIZE, b"\0"))
+
+        data = b"".join(self.fragments[i] for i in range(self.last))
+        return data.rstrip(b"\0").decode("latin-1")
+
+
+async def main():
+    parser = argparse.ArgumentParser(description="Execute a console command via the OpenKNX diagnose ko")
+    parser.add_argument("--ga", required=True, help="group address of the diagnose ko")
+    parser.add_argument("--gateway", help="ip of the KNX/IP interface (default: automatic)")
+    parser.add_argument("--route", action="store_true", help="use routing instead of tunneling")
+    parser.add_argument("--timeout", type=float, default=2.0, help="timeout in seconds between two frames")
+    parser.add_argument("command", nargs="+")
+    args = parser.parse_args()
+
+    if args.route:
+        config = ConnectionConfig(connection_type=ConnectionType.ROUTING)
+    elif args.gateway:
+        config = ConnectionConfig(connection_type=ConnectionType.TUNNELING, gateway_ip=args.gateway)
+    else:
+        config = ConnectionConfig()
+
+    xknx = XKNX(connection_config=config)
+    client = Client(xknx, args.ga, args.timeout)
+    xknx.telegram_queue.register_telegram_received_cb(client.received)
+    await xknx.start()
+    try:
+        print(await client.execute(" ".join(args.command)))
+        if client.truncated:
+            print("[answer truncated by the device (OPENKNX_DIAGNOSE_RESPONSE_SIZE)]", file=sys.stderr)
+    finally:
+        await xknx.stop()
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except RuntimeError as error:
+        sys.exit(str(error))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Convert the output of the console command "trace dump" (OPENKNX_EVENTTRACE)
+into the Chrome-Trace JSON format, which can be opened with https://ui.perfetto.dev
+or chrome://tracing.
+
+Usage:
+    eventtrace2chrome.py <captured-console-log> [<output.json>]
+
+The log can contain any other output. Only lines with the "EventTrace:" prefix
+between BEGIN and END of the last dump are used.
+"""
+import json
+import re
+import sys
+
+LINE = re.compile(r"EventTrace:\s+(.*)$")
+
+
+def parse(lines):
+    names = {}
+    records = []
+    for line in lines:
+        match = LINE.search(line.rstrip())
+        if not match:
+            continue
+        fields = match.group(1).split(" ", 4)
+        if fields[0] == "BEGIN":
+            # only keep the last dump
+            names = {}
+            records = []
+        elif fields[0] == "N" and len(fields) >= 3:
+            names[int(fields[1], 16)] = " ".join(fields[2:])
+        elif fields[0] == "R" and len(fields) >= 5:
+            records.append((int(fields[1], 16), int(fields[2], 16), fields[3], int(fields[4])))
+    return names, records
+
+
+def event_name(names, id):
+    if id in names:
+        return names[id]
+    return "Event 0x%04X" % id
+
+
+def convert(names, records):
+    events = []
+    offset = 0
+    last = None
+    start = None
+    for time, id, type, core in records:
+        # micros() is 32 bit and overflows after ~71 minutes
+        if last is not None and time < last and last - time > 0x80000000:
+            offset += 0x100000000
+        last = time
+        timestamp = time + offset
+        if start is None:
+            start = timestamp
+
+        event = {
+            "name": event_name(names, id),
+            "ph": type,
+            "ts": timestamp - start,
+            "pid": 0,
+            "tid": core,
+        }
+        if type == "i":
+            event["s"] = "t"
+        events.append(event)
+
+    metadata = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": core, "args": {"name": "Core %d" % core}} for core in sorted(set(r[3] for r in records))]
+    return {"traceEvents": metadata + events, "displayTimeUnit": "ms"}
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+
+    with open(sys.argv[1], "r", encoding="utf-8", errors="replace") as file:
+        names, records = parse(file)
+
+    if not records:
+        print("no trace records found")
+        return 1
+
+    output = sys.argv[2] if len(sys.argv) > 2 else re.sub(r"(\.[^.]*)?$", ".json", sys.argv[1], 1)
+    with open(output, "w", encoding="utf-8") as file:
+        json.dump(convert(names, records), file)
+
+    print("%d events written to %s" % (len(records), output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
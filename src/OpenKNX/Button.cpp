@@ -3,95 +3,53 @@
 
 namespace OpenKNX
 {
-    void __time_critical_func(Button::loop)()
+    void Button::init()
     {
-        if (_pressed)
-        {
-            // first press?
-            if (!_holdTimer)
-            {
-                _processed = false;
-                _holdTimer = millis();
-                // #ifdef OPENKNX_RTT
-                logTraceP("  Pressed");
-                // #endif
-            }
-        }
-        else
-        {
-            if (_holdTimer)
-            {
-                if (_doubleClickCallback == nullptr)
-                {
-                    // No wait for double click for faster response
-                    if (!_processed && _holdTimer && delayCheck(_holdTimer, OPENKNX_BUTTON_DEBOUNCE))
-                    {
-                        callShortClickCallback();
-                    }
-                }
-                else
-                {
-                    if (_dblClickTimer)
-                    {
-                        _dblClickTimer = 0;
-                        callDoubleClickCallback();
-                        _processed = true;
-                    }
-                    else if (!_processed)
-                    {
-                        _dblClickTimer = millis();
-                    }
-                }
-            }
-
-            _holdTimer = 0;
-        }
-
-        if (!_processed)
-        {
-            if (_dblClickTimer && delayCheck(_dblClickTimer, OPENKNX_BUTTON_DOUBLE_CLICK))
-            {
-                callShortClickCallback();
-                _dblClickTimer = 0;
-                _processed = true;
-            }
-
-            if (_holdTimer && delayCheck(_holdTimer, OPENKNX_BUTTON_LONG_CLICK))
-            {
-                callLongClickCallback();
-                _dblClickTimer = 0;
-                _processed = true;
-            }
-        }
+        _input = openknx.buttons.add(_id, [this](const ButtonEvent &event) { handle(event); }, maxClicks());
     }
 
-    void __time_critical_func(Button::change)(bool status)
+    void __time_critical_func(Button::change)(bool pressed)
     {
-        _pressed = status;
+        openknx.buttons.edge(_input, pressed);
     }
 
-    void Button::callShortClickCallback()
+    void Button::onDoubleClick(DoubleClickCallbackFunction doubleCallback)
     {
-        // #ifdef OPENKNX_RTT
-        logTraceP("ShortClick");
-        // #endif
-        if (_shortClickCallback != nullptr) _shortClickCallback();
+        _doubleClickCallback = doubleCallback;
+        // without a double click callback the short click is reported directly on release
+        openknx.buttons.configure(_input, maxClicks());
     }
 
-    void Button::callLongClickCallback()
+    uint8_t Button::maxClicks()
     {
-        // #ifdef OPENKNX_RTT
-        logTraceP("LongClick");
-        // #endif
-        if (_longClickCallback != nullptr) _longClickCallback();
+        return _doubleClickCallback != nullptr ? 2 : 1;
     }
 
-    void Button::callDoubleClickCallback()
+    void Button::handle(const ButtonEvent &event)
     {
-        // #ifdef OPENKNX_RTT
-        logTraceP("DoubleClick");
-        // #endif
-        if (_doubleClickCallback != nullptr) _doubleClickCallback();
+        switch (event.gesture)
+        {
+            case ButtonGesture::Click:
+                if (event.count == 1)
+                {
+                    logTraceP("ShortClick");
+                    if (_shortClickCallback != nullptr) _shortClickCallback();
+                }
+                else if (event.count == 2)
+                {
+                    logTraceP("DoubleClick");
+                    if (_doubleClickCallback != nullptr) _doubleClickCallback();
+                }
+                break;
+
+            case ButtonGesture::Hold:
+                logTraceP("LongClick");
+                if (_longClickCallback != nullptr) _longClickCallback();
+                break;
+
+            default:
+                break;
+        }
     }
 
     std::string Button::logPrefix()
@@ -99,4 +57,4 @@ namespace OpenKNX
         return openknx.logger.buildPrefix("Button", _id);
     }
 
-} // namespace OpenKNX
\ No newline at end of file
+} // namespace OpenKNX
@@ -0,0 +1,221 @@
+#include "OpenKNX/Buttons.h"
+#include "OpenKNX/Facade.h"
+
+static_assert(OPENKNX_BUTTON_MAX <= 32, "OPENKNX_BUTTON_MAX must not exceed 32");
+
+namespace OpenKNX
+{
+    std::string Buttons::logPrefix()
+    {
+        return "Buttons";
+    }
+
+    uint8_t Buttons::add(const char *name, ButtonEventCallback handler, uint8_t maxClicks /* = 1 */, uint16_t repeatInterval /* = 0 */)
+    {
+        if (_count >= OPENKNX_BUTTON_MAX)
+        {
+            logErrorP("Unable to add %s (max %u inputs)", name, OPENKNX_BUTTON_MAX);
+            return 0xFF;
+        }
+
+        const uint8_t input = _count;
+        _name[input] = name;
+        _handler[input] = handler;
+        configure(input, maxClicks, repeatInterval);
+        _count++;
+        return input;
+    }
+
+    void Buttons::configure(uint8_t input, uint8_t maxClicks, uint16_t repeatInterval /* = 0 */)
+    {
+        if (input >= OPENKNX_BUTTON_MAX)
+            return;
+
+        _maxClicks[input] = MAX(maxClicks, 1);
+        _repeatInterval[input] = repeatInterval;
+    }
+
+    void __time_critical_func(Buttons::edge)(uint8_t input, bool pressed)
+    {
+        if (input >= _count)
+            return;
+
+        const uint32_t mask = 1UL << input;
+        const uint32_t state = _lock.lock();
+        // the time is written first, so process() sees a new level only with its time
+        _edgeTime[input] = millis();
+        if (pressed)
+            _raw = _raw | mask;
+        else
+            _raw = _raw & ~mask;
+        _lock.unlock(state);
+
+#ifdef OPENKNX_TICKLESS
+        openknx.timerInterrupt.wakeup();
+#endif
+    }
+
+    bool __time_critical_func(Buttons::active)()
+    {
+        return _active || (_raw ^ _stable);
+    }
+
+    void __time_critical_func(Buttons::process)(uint32_t now)
+    {
+        uint32_t pending = _active | (_raw ^ _stable);
+        for (uint8_t input = 0; pending; input++, pending >>= 1)
+            if (pending & 1)
+                step(input, now);
+    }
+
+    void __time_critical_func(Buttons::step)(uint8_t input, uint32_t now)
+    {
+        const uint32_t mask = 1UL << input;
+
+        // accept a new level after it was stable for the debounce time - the edge is dated to its isr
+        if ((_raw ^ _stable) & mask)
+        {
+            const uint32_t time = _edgeTime[input];
+            if (now - time >= OPENKNX_BUTTON_DEBOUNCE)
+            {
+                _stable ^= mask;
+                if (_stable & mask)
+                    pressed(input, time);
+                else
+                    released(input, time);
+            }
+        }
+
+        timeout(input, now);
+
+        if (_state[input] == Idle)
+            _active &= ~mask;
+        else
+            _active |= mask;
+    }
+
+    void __time_critical_func(Buttons::pressed)(uint8_t input, uint32_t time)
+    {
+        _clicks[input] = _state[input] == WaitClick ? _clicks[input] + 1 : 1;
+        _state[input] = Pressed;
+        _since[input] = time;
+    }
+
+    void __time_critical_func(Buttons::released)(uint8_t input, uint32_t time)
+    {
+        switch (_state[input])
+        {
+            case Pressed:
+                if (_clicks[input] >= _maxClicks[input])
+                {
+                    emit(input, ButtonGesture::Click, _clicks[input], time);
+                    _state[input] = Idle;
+                }
+                else
+                {
+                    _state[input] = WaitClick;
+                    _since[input] = time;
+                }
+                break;
+
+            case Held:
+            case HeldLong:
+                emit(input, ButtonGesture::Release, _clicks[input], time);
+                _state[input] = Idle;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void __time_critical_func(Buttons::timeout)(uint8_t input, uint32_t now)
+    {
+        const uint32_t duration = now - _since[input];
+        switch (_state[input])
+        {
+            case Pressed:
+                if (duration >= OPENKNX_BUTTON_LONG_CLICK)
+                {
+                    emit(input, ButtonGesture::Hold, _clicks[input], now);
+                    _state[input] = Held;
+                    _repeats[input] = 0;
+                }
+                break;
+
+            case Held:
+            case HeldLong:
+                if (_state[input] == Held && duration >= OPENKNX_BUTTON_LONGLONG_CLICK)
+                {
+                    emit(input, ButtonGesture::LongLong, _clicks[input], now);
+                    _state[input] = HeldLong;
+                }
+
+                if (_repeatInterval[input] > 0 && (duration - OPENKNX_BUTTON_LONG_CLICK) / _repeatInterval[input] > _repeats[input])
+                {
+                    _repeats[input]++;
+                    emit(input, ButtonGesture::HoldRepeat, MIN(_repeats[input], 255), now);
+                }
+                break;
+
+            case WaitClick:
+                if (duration >= OPENKNX_BUTTON_DOUBLE_CLICK)
+                {
+                    emit(input, ButtonGesture::Click, _clicks[input], now);
+                    _state[input] = Idle;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void __time_critical_func(Buttons::emit)(uint8_t input, ButtonGesture gesture, uint8_t count, uint32_t time)
+    {
+        if (!_events.push({time, input, gesture, count}))
+        {
+            _dropped++;
+            return;
+        }
+
+        const uint16_t size = _events.size();
+        if (size > _eventsMax) _eventsMax = size;
+    }
+
+    void Buttons::loop()
+    {
+        ButtonEvent event;
+        while (_events.pop(event))
+        {
+            logTraceP("%s: %s (%u)", _name[event.input], gestureName(event.gesture), event.count);
+            if (_handler[event.input] != nullptr) _handler[event.input](event);
+        }
+    }
+
+    const char *Buttons::gestureName(ButtonGesture gesture)
+    {
+        switch (gesture)
+        {
+            case ButtonGesture::Click:
+                return "Click";
+            case ButtonGesture::Hold:
+                return "Hold";
+            case ButtonGesture::HoldRepeat:
+                return "HoldRepeat";
+            case ButtonGesture::LongLong:
+                return "LongLong";
+            case ButtonGesture::Release:
+                return "Release";
+        }
+        return "Unknown";
+    }
+
+    void Buttons::showStatus()
+    {
+        logInfoP("Inputs: %u of %u (active 0x%08X)", _count, OPENKNX_BUTTON_MAX, _active);
+        logInfoP("Events: %u (max %u of %u), dropped %u", _events.size(), _eventsMax, OPENKNX_BUTTON_QUEUE_SIZE, _dropped);
+        for (uint8_t input = 0; input < _count; input++)
+            logInfoP("%-16s %-8s clicks %u  max clicks %u  repeat %u ms", _name[input], (_stable & (1UL << input)) ? "pressed" : "released", _clicks[input], _maxClicks[input], _repeatInterval[input]);
+    }
+} // namespace OpenKNX
@@ -0,0 +1,138 @@
+#pragma once
+#include "OpenKNX/Queue.h"
+#include "OpenKNX/SpinLock.h"
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <functional>
+#include <string>
+
+#ifndef OPENKNX_BUTTON_DEBOUNCE
+    #define OPENKNX_BUTTON_DEBOUNCE 50
+#endif
+#ifndef OPENKNX_BUTTON_DOUBLE_CLICK
+    #define OPENKNX_BUTTON_DOUBLE_CLICK 500
+#endif
+#ifndef OPENKNX_BUTTON_LONG_CLICK
+    #define OPENKNX_BUTTON_LONG_CLICK 1000
+#endif
+#ifndef OPENKNX_BUTTON_LONGLONG_CLICK
+    #define OPENKNX_BUTTON_LONGLONG_CLICK 5000
+#endif
+
+// max inputs (bitmasks of 32 bit)
+#ifndef OPENKNX_BUTTON_MAX
+    #ifdef ARDUINO_ARCH_SAMD
+        #define OPENKNX_BUTTON_MAX 8
+    #else
+        #define OPENKNX_BUTTON_MAX 32
+    #endif
+#endif
+
+#ifndef OPENKNX_BUTTON_QUEUE_SIZE
+    #define OPENKNX_BUTTON_QUEUE_SIZE 16
+#endif
+
+namespace OpenKNX
+{
+    enum class ButtonGesture : uint8_t
+    {
+        Click,      // released and no further click within OPENKNX_BUTTON_DOUBLE_CLICK (count = number of clicks)
+        Hold,       // pressed for OPENKNX_BUTTON_LONG_CLICK (count = number of clicks including this press)
+        HoldRepeat, // repeated while held with the interval of the input (count = repetition, saturated at 255)
+        LongLong,   // pressed for OPENKNX_BUTTON_LONGLONG_CLICK
+        Release,    // released after Hold
+    };
+
+    struct ButtonEvent
+    {
+        uint32_t time; // millis of the edge (or of the timeout)
+        uint8_t input;
+        ButtonGesture gesture;
+        uint8_t count;
+    };
+
+    typedef std::function<void(const ButtonEvent &)> ButtonEventCallback;
+
+    /*
+     * Gesture detection for many inputs (openknx.buttons).
+     *
+     * The ISR of an input only stores the raw level and the time of the edge (edge()).
+     * The timer interrupt debounces the edges and runs the state machines (process()),
+     * which are stored as struct of arrays, so idle inputs only cost a bit in a mask.
+     * Detected gestures are put into a lock-free queue and the handlers are called in the loop of core0.
+     */
+    class Buttons
+    {
+      private:
+        enum State : uint8_t
+        {
+            Idle,
+            Pressed,
+            Held,
+            HeldLong,
+            WaitClick,
+        };
+
+        uint8_t _count = 0;
+        volatile uint32_t _raw = 0; // written by the isr
+        uint32_t _stable = 0;
+        uint32_t _active = 0; // inputs with a running state machine
+        volatile uint32_t _edgeTime[OPENKNX_BUTTON_MAX] = {};
+        uint32_t _since[OPENKNX_BUTTON_MAX] = {};
+        State _state[OPENKNX_BUTTON_MAX] = {};
+        uint8_t _clicks[OPENKNX_BUTTON_MAX] = {};
+        // 32 bit, so the due time of the next repetition never wraps while the button is held
+        uint32_t _repeats[OPENKNX_BUTTON_MAX] = {};
+
+        // configuration
+        const char *_name[OPENKNX_BUTTON_MAX] = {};
+        uint8_t _maxClicks[OPENKNX_BUTTON_MAX] = {};
+        uint16_t _repeatInterval[OPENKNX_BUTTON_MAX] = {};
+        ButtonEventCallback _handler[OPENKNX_BUTTON_MAX];
+
+        SpscQueue<ButtonEvent, OPENKNX_BUTTON_QUEUE_SIZE> _events;
+        uint16_t _eventsMax = 0;
+        uint32_t _dropped = 0;
+        SpinLock _lock;
+
+        inline void step(uint8_t input, uint32_t now);
+        inline void pressed(uint8_t input, uint32_t time);
+        inline void released(uint8_t input, uint32_t time);
+        inline void timeout(uint8_t input, uint32_t now);
+        void emit(uint8_t input, ButtonGesture gesture, uint8_t count, uint32_t time);
+        static const char *gestureName(ButtonGesture gesture);
+
+      public:
+        /*
+         * Register an input
+         * @param maxClicks a click is reported directly on release when reached (no wait for a further click)
+         * @param repeatInterval in ms for HoldRepeat, 0 = no repetition
+         * @return index of the input or 0xFF if all inputs are used
+         */
+        uint8_t add(const char *name, ButtonEventCallback handler, uint8_t maxClicks = 1, uint16_t repeatInterval = 0);
+        void configure(uint8_t input, uint8_t maxClicks, uint16_t repeatInterval = 0);
+
+        /*
+         * Report the raw level of an input (called by the isr of the pin or by polling)
+         */
+        void edge(uint8_t input, bool pressed);
+
+        /*
+         * Debounce and detect the gestures (called by the timer interrupt)
+         */
+        void process(uint32_t now);
+
+        /*
+         * Needs to be processed (pressed, bouncing or waiting for a further click)
+         */
+        bool active();
+
+        /*
+         * Call the handlers of the detected gestures (called in the loop of core0)
+         */
+        void loop();
+
+        void showStatus();
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
@@ -1,5 +1,6 @@
 #include "OpenKNX/Common.h"
 #include "OpenKNX/Facade.h"
+#include "OpenKNX/Stat/HeapHook.h"
 #include "OpenKNX/Stat/RuntimeStat.h"
 
 #if defined(OPENKNX_DUALCORE) && defined(ARDUINO_ARCH_ESP32)
@@ -16,16 +17,35 @@ namespace OpenKNX
 
     void Common::init(uint8_t firmwareRevision)
     {
+#ifdef OPENKNX_BOOTPROFILE
+        openknx.bootProfile.init();
+#endif
+        BOOTPROFILE_BEGIN(Stat::BootInit);
+#if defined(ARDUINO_ARCH_RP2040)
+        paintStack(_stackPaint);
+#elif defined(ARDUINO_ARCH_ESP32)
+        _stackTask = xTaskGetCurrentTaskHandle();
+#endif
         ArduinoPlatform::SerialDebug = new OpenKNX::Log::VirtualSerial("KNX");
 
+        BOOTPROFILE_BEGIN(Stat::BootTimers);
         openknx.timerInterrupt.init();
+        openknx.timers.init();
+        BOOTPROFILE_END(Stat::BootTimers);
+
+        BOOTPROFILE_BEGIN(Stat::BootLeds);
         openknx.hardware.initLeds();
+        BOOTPROFILE_END(Stat::BootLeds);
 
 #if defined(PROG_BUTTON_PIN) && PROG_BUTTON_PIN >= 0 && OPENKNX_RECOVERY_TIME > 0
+        BOOTPROFILE_BEGIN(Stat::BootRecovery);
         processRecovery();
+        BOOTPROFILE_END(Stat::BootRecovery);
 #endif
 
+        BOOTPROFILE_BEGIN(Stat::BootButtons);
         openknx.hardware.initButtons();
+        BOOTPROFILE_END(Stat::BootButtons);
 
 #ifdef OPENKNX_NO_BOOT_PULSATING
         openknx.progLed.on();
@@ -39,7 +59,9 @@ namespace OpenKNX
     #endif
 #endif
 
+        BOOTPROFILE_BEGIN(Stat::BootDebugWait);
         debugWait();
+        BOOTPROFILE_END(Stat::BootDebugWait);
 
         if (openknx.watchdog.lastReset()) logErrorP("Restarted by watchdog");
 
@@ -49,13 +71,20 @@ namespace OpenKNX
         showDebugInfo();
 #endif
 
+        BOOTPROFILE_BEGIN(Stat::BootFlashInit);
         openknx.hardware.initFlash();
+        BOOTPROFILE_END(Stat::BootFlashInit);
         openknx.info.serialNumber(knx.platform().uniqueSerialNumber());
         openknx.info.firmwareRevision(firmwareRevision);
 
+        BOOTPROFILE_BEGIN(Stat::BootKnxInit);
         initKnx();
+        BOOTPROFILE_END(Stat::BootKnxInit);
 
+        BOOTPROFILE_BEGIN(Stat::BootHardware);
         openknx.hardware.init();
+        BOOTPROFILE_END(Stat::BootHardware);
+        BOOTPROFILE_END(Stat::BootInit);
     }
 
 #ifdef OPENKNX_DEBUG
@@ -135,7 +164,9 @@ namespace OpenKNX
         // set correct hardware type for flash compatibility check
         knx.bau().deviceObject().hardwareType(hardwareType);
         // read flash data
+        BOOTPROFILE_BEGIN(Stat::BootKnxReadMemory);
         knx.readMemory();
+        BOOTPROFILE_END(Stat::BootKnxReadMemory);
         // set hardware type again, in case an other hardware type was deserialized from flash
         knx.bau().deviceObject().hardwareType(hardwareType);
         // set firmware version as user info (PID_VERSION)
@@ -215,9 +246,15 @@ namespace OpenKNX
 
     void Common::setup()
     {
+        BOOTPROFILE_BEGIN(Stat::BootSetup);
         // Handle init of modules
         for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + i);
+            BOOTPROFILE_BEGIN(Stat::BootModuleInit + i);
             openknx.modules.list[i]->init();
+            BOOTPROFILE_END(Stat::BootModuleInit + i);
+        }
 
 #ifdef BASE_StartupDelayBase
         _startupDelay = millis();
@@ -232,12 +269,26 @@ namespace OpenKNX
 
         // Handle setup of modules
         for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + i);
+            BOOTPROFILE_BEGIN(Stat::BootModuleSetup + i);
             openknx.modules.list[i]->setup(configured);
+            BOOTPROFILE_END(Stat::BootModuleSetup + i);
+        }
+
+#ifdef OPENKNX_KO_QUEUE
+        initInputKoDispatch();
+#endif
+#ifdef OPENKNX_KO_BATCH
+        if (configured) _inputKoBatch.init();
+#endif
 
         if (configured) openknx.flash.load();
 
         // start the framework + isr if needed
+        BOOTPROFILE_BEGIN(Stat::BootKnxStart);
         knx.start();
+        BOOTPROFILE_END(Stat::BootKnxStart);
         openknx.hardware.initKnxRxISR();
 
 #ifdef OPENKNX_WATCHDOG
@@ -262,19 +313,27 @@ namespace OpenKNX
     #endif
 
         // if we have a second core wait for setup1 is done
+        BOOTPROFILE_BEGIN(Stat::BootSetup1Wait);
         if (openknx.usesDualCore())
             while (!_setup1Ready)
                 delay(1);
+        BOOTPROFILE_END(Stat::BootSetup1Wait);
 #endif // OPENKNX_DUALCORE
 
 #ifndef OPENKNX_DUALCORE
         openknx.progLed.off();
 #endif
+        BOOTPROFILE_END(Stat::BootSetup);
     }
 
 #ifdef OPENKNX_DUALCORE
     void Common::setup1()
     {
+    #if defined(ARDUINO_ARCH_RP2040)
+        paintStack(_stackPaint1);
+    #elif defined(ARDUINO_ARCH_ESP32)
+        _stackTask1 = xTaskGetCurrentTaskHandle();
+    #endif
         openknx.timerInterrupt.init1();
 
         // wait for setup0
@@ -293,7 +352,10 @@ namespace OpenKNX
 
         // Handle setup1 of modules
         for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + i);
             openknx.modules.list[i]->setup1(configured);
+        }
 
         _setup1Ready = true;
         openknx.progLed.off();
@@ -303,10 +365,6 @@ namespace OpenKNX
     // main loop
     void Common::loop()
     {
-#ifdef ARDUINO_ARCH_ESP32
-        collectStackStats();
-#endif
-
         _skipLooptimeWarning = false;
 
         uptime(false);
@@ -317,6 +375,7 @@ namespace OpenKNX
 #endif
 
         RUNTIME_MEASURE_BEGIN(_runtimeLoop);
+        EVENTTRACE_BEGIN(Stat::EventTraceLoop);
 
 #ifdef OPENKNX_HEARTBEAT
         openknx.progLed.debugLoop();
@@ -331,14 +390,44 @@ namespace OpenKNX
 
         // loop console helper
         RUNTIME_MEASURE_BEGIN(_runtimeConsole);
-        openknx.console.loop();
+        EVENTTRACE_BEGIN(Stat::EventTraceConsole);
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerConsole);
+            openknx.console.loop();
+        }
+        EVENTTRACE_END(Stat::EventTraceConsole);
         RUNTIME_MEASURE_END(_runtimeConsole);
 
         // loop  knx stack
         RUNTIME_MEASURE_BEGIN(_runtimeKnxStack);
-        knx.loop();
+        EVENTTRACE_BEGIN(Stat::EventTraceKnxStack);
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerKnxStack);
+            knx.loop();
+        }
+        EVENTTRACE_END(Stat::EventTraceKnxStack);
         RUNTIME_MEASURE_END(_runtimeKnxStack);
 
+#ifdef OPENKNX_KO_BATCH
+        // deliver changed KOs once per loop
+        processInputKoBatch();
+#endif
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        // rate limited sends of the modules
+        openknx.transmit.loop();
+#endif
+
+#ifdef ARDUINO_ARCH_RP2040
+        sampleHeap();
+#endif
+
+        // deferred callbacks of the timer wheel
+        openknx.timers.loop();
+
+        // gestures detected by the timer interrupt
+        openknx.buttons.loop();
+
         // loop  appstack
         _loopMicros = micros();
 
@@ -357,12 +446,23 @@ namespace OpenKNX
             processSavePin();
             processRestoreSavePin();
             processAfterStartupDelay();
+            processStartupSteps();
         }
 
         RUNTIME_MEASURE_BEGIN(_runtimeModuleLoop);
+        EVENTTRACE_BEGIN(Stat::EventTraceModules);
         processModulesLoop();
+        EVENTTRACE_END(Stat::EventTraceModules);
         RUNTIME_MEASURE_END(_runtimeModuleLoop);
 
+        EVENTTRACE_BEGIN(Stat::EventTraceTasks);
+        processTasks();
+        EVENTTRACE_END(Stat::EventTraceTasks);
+
+        // erase the next flash slot sector by sector (not in the boot path)
+        openknx.flash.loop();
+
+        EVENTTRACE_END(Stat::EventTraceLoop);
         RUNTIME_MEASURE_END(_runtimeLoop);
 
 #if OPENKNX_LOOPTIME_WARNING > 1
@@ -420,27 +520,59 @@ namespace OpenKNX
 
     void __time_critical_func(Common::collectHeapStats)()
     {
+#if defined(ARDUINO_ARCH_RP2040)
+        // running minimum by operator new/delete, mallinfo is sampled in loop context (sampleHeap)
+#elif defined(ARDUINO_ARCH_ESP32)
+        // tracked by the heap implementation
+#else
         _freeMemoryMin = MIN(_freeMemoryMin, freeMemory());
+#endif
     }
 
-    void __time_critical_func(Common::collectStackStats)()
+#ifdef ARDUINO_ARCH_RP2040
+    /*
+     * Calibrate the running minimum of the free heap with mallinfo (expensive, so only at a low rate in the loop).
+     * Trade-off: malloc itself can not be hooked (the core already wraps it with --wrap=malloc for its lock), so a short
+     * peak of a direct malloc between two samples is missed. Allocations by new are seen immediately.
+     */
+    void Common::sampleHeap()
     {
-#if defined(ARDUINO_ARCH_RP2040)
-    #ifdef OPENKNX_DUALCORE
-        if (rp2040.cpuid())
-            _freeStackMin1 = MIN(_freeStackMin1, rp2040.getFreeStack());
-        else
-    #endif
-            _freeStackMin = MIN(_freeStackMin, rp2040.getFreeStack());
-#elif defined(ARDUINO_ARCH_ESP32)
-    #ifdef OPENKNX_DUALCORE
-        if (!xPortGetCoreID())
-            _freeStackMin1 = uxTaskGetStackHighWaterMark(nullptr);
-        else
-    #endif
-            _freeStackMin = uxTaskGetStackHighWaterMark(nullptr);
-#endif
+        if (!delayCheck(_heapSampled, OPENKNX_HEAP_SAMPLE_INTERVAL))
+            return;
+
+        _heapSampled = millis();
+        Stat::heapCalibrate(freeMemory());
+    }
+
+    /*
+     * Fill the unused stack of the calling core (must be called on each core)
+     */
+    void Common::paintStack(StackPaint &paint)
+    {
+        uint32_t marker = 0;
+        const int32_t free = rp2040.getFreeStack();
+        // the marker is above the stack pointer used by getFreeStack, so the bottom is never too low
+        paint.bottom = (uint32_t *)(((uint32_t)&marker - free + 3) & ~3);
+        paint.words = free > OPENKNX_STACK_PAINT_RESERVE ? (free - OPENKNX_STACK_PAINT_RESERVE) / 4 : 0;
+
+        // interrupts use the same stack
+        noInterrupts();
+        for (uint32_t i = 0; i < paint.words; i++)
+            paint.bottom[i] = OPENKNX_STACK_PAINT_PATTERN;
+        interrupts();
+    }
+
+    int Common::scanStack(StackPaint &paint)
+    {
+        // the high water mark only grows, so the next scan can stop here
+        uint32_t words = 0;
+        while (words < paint.words && paint.bottom[words] == OPENKNX_STACK_PAINT_PATTERN)
+            words++;
+
+        paint.words = words;
+        return words * 4;
     }
+#endif
 
     /**
      * Run loop() of as many modules as possible, within available free loop time.
@@ -460,19 +592,38 @@ namespace OpenKNX
         do
         {
             RUNTIME_MEASURE_BEGIN(openknx.modules.runtime[_currentModule]);
+            EVENTTRACE_BEGIN(Stat::EventTraceModule + _currentModule);
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + _currentModule);
+#ifdef OPENKNX_KO_QUEUE
+            if (openknx.modules.koDispatch[_currentModule] == InputKoDispatch::Loop)
+                processInputKoQueue(_currentModule);
+#endif
+            STATE_BY_CORE(_loopModule) = _currentModule;
             openknx.modules.list[_currentModule]->loop(configured);
+            STATE_BY_CORE(_loopModule) = NoModule;
+            EVENTTRACE_END(Stat::EventTraceModule + _currentModule);
             RUNTIME_MEASURE_END(openknx.modules.runtime[_currentModule]);
         }
         while (freeLoopIterate(openknx.modules.count, _currentModule, processed));
     }
 
+    /**
+     * Run tasks of the shared task queue within available free loop time.
+     * Without a second core at least one task is processed per loop to guarantee progress.
+     */
+    void Common::processTasks()
+    {
+        if (!openknx.usesDualCore())
+            openknx.tasks.process();
+
+        while (freeLoopTime())
+            if (!openknx.tasks.process())
+                break;
+    }
+
 #ifdef OPENKNX_DUALCORE
     void Common::loop1()
     {
-    #ifdef ARDUINO_ARCH_ESP32
-        collectStackStats();
-    #endif
-
         if (!_setup1Ready) return;
 
     #ifdef OPENKNX_HEARTBEAT
@@ -483,23 +634,54 @@ namespace OpenKNX
 
         bool configured = knx.configured();
 
+        EVENTTRACE_BEGIN(Stat::EventTraceLoop1);
         for (uint8_t i = 0; i < openknx.modules.count; i++)
         {
             RUNTIME_MEASURE_BEGIN(openknx.modules.runtime1[i]);
+            EVENTTRACE_BEGIN(Stat::EventTraceModule1 + i);
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + i);
+    #ifdef OPENKNX_KO_QUEUE
+            if (openknx.modules.koDispatch[i] == InputKoDispatch::Loop1)
+                processInputKoQueue(i);
+    #endif
+            STATE_BY_CORE(_loopModule) = i;
             openknx.modules.list[i]->loop1(configured);
+            STATE_BY_CORE(_loopModule) = NoModule;
+            EVENTTRACE_END(Stat::EventTraceModule1 + i);
             RUNTIME_MEASURE_END(openknx.modules.runtime1[i]);
         }
+        EVENTTRACE_END(Stat::EventTraceLoop1);
+
+        // core1 has no other duties, so all pending tasks are processed
+        EVENTTRACE_BEGIN(Stat::EventTraceTasks);
+        while (openknx.tasks.process())
+        {
+        }
+        EVENTTRACE_END(Stat::EventTraceTasks);
     }
 #endif
 
     bool Common::afterStartupDelay()
     {
-        return _afterStartupDelay;
+        if (!_afterStartupDelay)
+            return false;
+
+        // in the loop of a module, which has not run its first startup step yet
+        const uint8_t module = STATE_BY_CORE(_loopModule);
+        return module == NoModule || moduleStarted(module);
+    }
+
+    /*
+     * The module has run (at least) its first processAfterStartupDelayStep
+     */
+    bool Common::moduleStarted(uint8_t module)
+    {
+        return _startupCompleted || module < _startupModule || (module == _startupModule && _startupStep > 0);
     }
 
     void Common::processAfterStartupDelay()
     {
-        if (afterStartupDelay())
+        if (_startupDelayElapsed)
             return;
 
 #ifdef BASE_StartupDelayBase
@@ -508,18 +690,90 @@ namespace OpenKNX
 #endif
 
         logDebugP("processAfterStartupDelay");
-        openknx.console.showInformations();
-        openknx.logger.log("Type \"help\" to view a list of available commands.");
-        logIndentUp();
+        openknx.console.startJob([](uint16_t step) -> bool {
+            if (openknx.console.showInformationsStep(step))
+                return true;
 
-        _afterStartupDelay = true;
+            openknx.logger.log("Type \"help\" to view a list of available commands.");
+            return false;
+        });
 
-        for (uint8_t i = 0; i < openknx.modules.count; i++)
+        _startupDelayElapsed = true;
+        BOOTPROFILE_INSTANT(Stat::BootStartupDelay);
+
+        // spread the startup of the devices, which are powered up together, by a jitter from address and serial number
+        _startupJitter = ((uint32_t)openknx.info.individualAddress() << 16) ^ openknx.info.serialNumber();
+        _startupNext = millis() + startupJitter(OPENKNX_STARTUP_JITTER);
+        logDebugP("Startup of modules in %ums", _startupNext - millis());
+    }
+
+    bool Common::startupCompleted()
+    {
+        return _startupCompleted;
+    }
+
+    /*
+     * Pseudo random value (xorshift) seeded by the device, so the devices differ but each device is reproducible
+     */
+    uint32_t Common::startupJitter(uint32_t max)
+    {
+        if (max == 0)
+            return 0;
+
+        uint32_t x = _startupJitter ? _startupJitter : 0x4F4B4E58;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        _startupJitter = x;
+        return x % max;
+    }
+
+    /*
+     * Calls one step of processAfterStartupDelayStep per interval, module by module
+     */
+    void Common::processStartupSteps()
+    {
+        if (_startupCompleted || !_startupDelayElapsed || (int32_t)(millis() - _startupNext) < 0)
+            return;
+
+        // from now on the modules run their startup
+        if (!_afterStartupDelay)
         {
-            openknx.modules.list[i]->processAfterStartupDelay();
+            _afterStartupDelay = true;
+            _startupBegin = millis();
         }
 
+        if (_startupModule >= openknx.modules.count)
+        {
+            logDebugP("Startup of modules completed");
+            _startupCompleted = true;
+            BOOTPROFILE_INSTANT(Stat::BootStartupCompleted);
+            return;
+        }
+
+        logIndentUp();
+        bool more = false;
+        {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + _startupModule);
+            more = openknx.modules.list[_startupModule]->processAfterStartupDelayStep(_startupStep);
+        }
         logIndentDown();
+
+        if (more)
+        {
+            _startupStep++;
+        }
+        else
+        {
+            _startupModule++;
+            _startupStep = 0;
+        }
+
+        // the duration grows with modules x steps - after OPENKNX_STARTUP_MAX_DURATION the remaining steps run one per loop
+        if (delayCheck(_startupBegin, OPENKNX_STARTUP_MAX_DURATION))
+            _startupNext = millis();
+        else
+            _startupNext = millis() + OPENKNX_STARTUP_STEP_INTERVAL + startupJitter(OPENKNX_STARTUP_STEP_INTERVAL / 2 + 1);
     }
 
 #ifdef BASE_HeartbeatDelayBase
@@ -541,6 +795,16 @@ namespace OpenKNX
 
             logDebugP("Send Heartbeat %i", value);
 
+    #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+            if (ParamBASE_HeartbeatExtended)
+            {
+                openknx.transmit.send(KoBASE_Heartbeat, value, DPT_DecimalFactor, TransmitPriority::High);
+            }
+            else
+            {
+                openknx.transmit.send(KoBASE_Heartbeat, true, DPT_Switch, TransmitPriority::High);
+            }
+    #else
             if (ParamBASE_HeartbeatExtended)
             {
                 KoBASE_Heartbeat.value(value, DPT_DecimalFactor);
@@ -549,6 +813,7 @@ namespace OpenKNX
             {
                 KoBASE_Heartbeat.value(true, DPT_Switch);
             }
+    #endif
 
             _firstStartup = false;
             _heartbeatDelay = millis();
@@ -684,6 +949,13 @@ namespace OpenKNX
     {
         logInfoP("processBeforeTablesUnload");
         logIndentUp();
+#ifdef OPENKNX_KO_QUEUE
+        // queued GroupObjects will be invalid after unload
+        _inputKoQueueActive = false;
+#endif
+#ifdef OPENKNX_KO_BATCH
+        _inputKoBatch.deactivate();
+#endif
         for (uint8_t i = 0; i < openknx.modules.count; i++)
         {
             openknx.modules.list[i]->processBeforeTablesUnload();
@@ -696,6 +968,9 @@ namespace OpenKNX
 #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
     void Common::processInputKo(GroupObject& ko)
     {
+        EVENTTRACE_INSTANT(Stat::EventTraceInputKo);
+        BOOTPROFILE_INSTANT(Stat::BootFirstTelegram);
+
     #ifdef BASE_KoDiagnose
         if (ko.asap() == BASE_KoDiagnose)
             return openknx.console.processDiagnoseKo(ko);
@@ -706,11 +981,156 @@ namespace OpenKNX
             return processSaveKo(ko);
     #endif
 
+    #ifdef OPENKNX_KO_BATCH
+        // deliver later in processInputKoBatch
+        if (_inputKoBatch.add(ko))
+            return;
+
+        // batch full - the pending KOs are delivered first, so the order of the KOs is kept
+        if (_inputKoBatch.size() > 0)
+        {
+            processInputKoBatch();
+            if (_inputKoBatch.add(ko))
+                return;
+        }
+    #endif
+
+        dispatchInputKo(ko);
+    }
+
+    /*
+     * Deliver the GroupObject to all interested modules (see registerInputKoRange)
+     */
+    void Common::dispatchInputKo(GroupObject& ko)
+    {
+        RUNTIME_MEASURE_BEGIN(_runtimeInputKo);
+        const uint32_t modules = _inputKoRouting.lookup(ko.asap());
+        uint8_t delivered = 0;
         for (uint8_t i = 0; i < openknx.modules.count; i++)
         {
+            if (!(modules & (1UL << i)))
+                continue;
+
+            delivered++;
+    #ifdef OPENKNX_KO_QUEUE
+            if (openknx.modules.koDispatch[i] != InputKoDispatch::Direct)
+            {
+                queueInputKo(i, ko);
+                continue;
+            }
+    #endif
+            HEAPTRACK_SCOPE(Stat::HeapOwnerModule + i);
             openknx.modules.list[i]->processInputKo(ko);
         }
+        _inputKoRouting.countDeliveries(delivered);
+        RUNTIME_MEASURE_END(_runtimeInputKo);
+    }
+
+    void Common::registerInputKoRange(Module& module, uint16_t first, uint16_t last)
+    {
+        for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            if (openknx.modules.list[i] != &module)
+                continue;
+
+            _inputKoRouting.add(i, first, last);
+            return;
+        }
+
+        logErrorP("registerInputKoRange: module %s is not added", module.name().c_str());
+    }
+
+    void Common::showInputKoRouting()
+    {
+        _inputKoRouting.showStatus();
+    }
+
+    #ifdef OPENKNX_KO_BATCH
+    /*
+     * Deliver all GroupObjects which have changed during knx.loop() once.
+     * KOs changed again during delivery will be delivered in the next loop.
+     */
+    void Common::processInputKoBatch()
+    {
+        uint16_t count = _inputKoBatch.size();
+        uint16_t asap = 0;
+        while (count-- > 0 && _inputKoBatch.pop(asap))
+            dispatchInputKo(knx.getGroupObject(asap));
+    }
+
+    void Common::showInputKoBatch()
+    {
+        _inputKoBatch.showStatus();
+    }
+    #endif
+
+    #ifdef OPENKNX_KO_QUEUE
+    void Common::initInputKoDispatch()
+    {
+        for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            InputKoDispatch dispatch = openknx.modules.list[i]->inputKoDispatch();
+
+            // without running loop1 the events are delivered on core0
+            if (dispatch == InputKoDispatch::Loop1 && !openknx.usesDualCore())
+                dispatch = InputKoDispatch::Loop;
+
+            openknx.modules.koDispatch[i] = dispatch;
+            openknx.modules.koQueueMax[i] = 0;
+            openknx.modules.koQueueDropped[i] = 0;
+        }
+        _inputKoQueueActive = true;
+    }
+
+    void Common::queueInputKo(uint8_t moduleIndex, GroupObject& ko)
+    {
+        SpscQueue<GroupObject*, OPENKNX_KO_QUEUE_SIZE>& queue = openknx.modules.koQueue[moduleIndex];
+        if (!queue.push(&ko))
+        {
+            openknx.modules.koQueueDropped[moduleIndex]++;
+            return;
+        }
+
+        const uint16_t size = queue.size();
+        if (size > openknx.modules.koQueueMax[moduleIndex])
+            openknx.modules.koQueueMax[moduleIndex] = size;
+    }
+
+    /**
+     * Deliver all queued GroupObjects of a module in one batch.
+     * Events which are queued during processing will be delivered in the next call.
+     * Must be called on the core which consumes the queue of the module.
+     */
+    void Common::processInputKoQueue(uint8_t moduleIndex)
+    {
+        SpscQueue<GroupObject*, OPENKNX_KO_QUEUE_SIZE>& queue = openknx.modules.koQueue[moduleIndex];
+        Module* module = openknx.modules.list[moduleIndex];
+        GroupObject* ko = nullptr;
+        HEAPTRACK_SCOPE(Stat::HeapOwnerModule + moduleIndex);
+
+        uint16_t count = queue.size();
+        while (count-- > 0 && _inputKoQueueActive && queue.pop(ko))
+            module->processInputKo(*ko);
+    }
+
+    void Common::showInputKoQueue()
+    {
+        for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            const InputKoDispatch dispatch = openknx.modules.koDispatch[i];
+            if (dispatch == InputKoDispatch::Direct)
+                continue;
+
+            logInfoP("%-20s %-5s queued %3u  max %3u/%u  dropped %u",
+                     openknx.modules.list[i]->name().c_str(),
+                     dispatch == InputKoDispatch::Loop1 ? "loop1" : "loop",
+                     openknx.modules.koQueue[i].size(),
+                     openknx.modules.koQueueMax[i],
+                     OPENKNX_KO_QUEUE_SIZE,
+                     openknx.modules.koQueueDropped[i]);
+        }
     }
+    #endif
 #endif
 
 #ifdef BASE_KoManualSave
@@ -777,24 +1197,59 @@ namespace OpenKNX
 
     uint Common::freeMemoryMin()
     {
+#if defined(ARDUINO_ARCH_ESP32)
+        return ESP.getMinFreeHeap();
+#elif defined(ARDUINO_ARCH_RP2040)
+        return MIN(Stat::heapFreeMin(), freeMemory());
+#else
         return _freeMemoryMin;
+#endif
     }
 
-#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32)
+#if defined(ARDUINO_ARCH_RP2040)
     int Common::freeStackMin()
     {
-        return _freeStackMin;
+        return scanStack(_stackPaint);
     }
     #ifdef OPENKNX_DUALCORE
     int Common::freeStackMin1()
     {
-        return _freeStackMin1;
+        return scanStack(_stackPaint1);
     }
     #endif
+#elif defined(ARDUINO_ARCH_ESP32)
+    int Common::freeStackMin()
+    {
+        return uxTaskGetStackHighWaterMark(_stackTask);
+    }
+    #ifdef OPENKNX_DUALCORE
+    int Common::freeStackMin1()
+    {
+        return uxTaskGetStackHighWaterMark(_stackTask1);
+    }
+    #endif
+#endif
+
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+    bool Common::registerFunctionProperty(uint8_t objectIndex, uint8_t propertyId, FunctionPropertyHandler command, FunctionPropertyHandler state /* = nullptr */)
+    {
+        return _functionProperties.add(objectIndex, propertyId, command, state);
+    }
+
+    bool Common::completeFunctionProperty(uint8_t objectIndex, uint8_t propertyId, const uint8_t* resultData, uint8_t resultLength)
+    {
+        return _functionProperties.complete(objectIndex, propertyId, resultData, resultLength);
+    }
 #endif
 
     bool Common::processFunctionProperty(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t* data, uint8_t* resultData, uint8_t& resultLength)
     {
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+        if (_functionProperties.processCommand(objectIndex, propertyId, length, data, resultData, resultLength))
+            return true;
+#endif
+
+        // fallback for modules without registered handlers
         for (uint8_t i = 0; i < openknx.modules.count; i++)
             if (openknx.modules.list[i]->processFunctionProperty(objectIndex, propertyId, length, data, resultData, resultLength))
                 return true;
@@ -804,6 +1259,12 @@ namespace OpenKNX
 
     bool Common::processFunctionPropertyState(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t* data, uint8_t* resultData, uint8_t& resultLength)
     {
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+        if (_functionProperties.processState(objectIndex, propertyId, length, data, resultData, resultLength))
+            return true;
+#endif
+
+        // fallback for modules without registered handlers
         for (uint8_t i = 0; i < openknx.modules.count; i++)
             if (openknx.modules.list[i]->processFunctionPropertyState(objectIndex, propertyId, length, data, resultData, resultLength))
                 return true;
@@ -822,24 +1283,46 @@ namespace OpenKNX
 #ifdef OPENKNX_RUNTIME_STAT
     void Common::showRuntimeStat(const bool stat /*= true*/, const bool hist /*= false*/)
     {
-        logInfoP("Runtime Statistics: (Uptime=%dms)", millis());
-        logIndentUp();
+        logBegin();
+        uint16_t step = 0;
+        while (showRuntimeStatStep(step++, stat, hist))
+            ;
+        logEnd();
+    }
+
+    /*
+     * Stepwise output of the runtime statistics, one module per step
+     */
+    bool Common::showRuntimeStatStep(uint16_t step, const bool stat /*= true*/, const bool hist /*= false*/)
+    {
+        if (step == 0)
         {
+            logInfoP("Runtime Statistics: (Uptime=%dms)", millis());
+            logIndentUp();
             Stat::RuntimeStat::showStatHeader();
             // Use prefix '_' to preserve structure on sorting
             _runtimeLoop.showStat("___Loop", 0, stat, hist);
             _runtimeConsole.showStat("__Console", 0, stat, hist);
             _runtimeKnxStack.showStat("__KnxStack", 0, stat, hist);
             _runtimeModuleLoop.showStat("_All_Modules_Loop", 0, stat, hist);
-            for (uint8_t i = 0; i < openknx.modules.count; i++)
-            {
-                openknx.modules.runtime[i].showStat(openknx.modules.list[i]->name().c_str(), 0, stat, hist);
-    #ifdef OPENKNX_DUALCORE
-                openknx.modules.runtime1[i].showStat(openknx.modules.list[i]->name().c_str(), 1, stat, hist);
+    #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+            _runtimeInputKo.showStat("_All_Modules_InputKo", 0, stat, hist);
     #endif
-            }
+            logIndentDown();
+            return openknx.modules.count > 0;
         }
+
+        const uint8_t i = step - 1;
+        if (i >= openknx.modules.count)
+            return false;
+
+        logIndentUp();
+        openknx.modules.runtime[i].showStat(openknx.modules.list[i]->name().c_str(), 0, stat, hist);
+    #ifdef OPENKNX_DUALCORE
+        openknx.modules.runtime1[i].showStat(openknx.modules.list[i]->name().c_str(), 1, stat, hist);
+    #endif
         logIndentDown();
+        return (i + 1) < openknx.modules.count;
     }
 #endif
 
@@ -1,4 +1,9 @@
 #pragma once
+#ifdef OPENKNX_KO_BATCH
+    #include "OpenKNX/KoBatch.h"
+#endif
+#include "OpenKNX/FunctionProperties.h"
+#include "OpenKNX/KoRouting.h"
 #include "OpenKNX/Log/Logger.h"
 #include "OpenKNX/Log/VirtualSerial.h"
 #ifdef OPENKNX_RUNTIME_STAT
@@ -9,6 +14,7 @@
 
 namespace OpenKNX
 {
+    class Module;
 
     class Common
     {
@@ -27,22 +33,38 @@ namespace OpenKNX
         uint32_t _savedPinProcessed = 0;
         bool _savePinTriggered = false;
         volatile int32_t _freeMemoryMin = 0x7FFFFFFF;
-#ifdef ARDUINO_ARCH_ESP32
-        volatile int32_t _freeStackMin = 0;
+#ifdef ARDUINO_ARCH_RP2040
+        uint32_t _heapSampled = 0;
+        void sampleHeap();
+
+        /*
+         * The free stack below the current stack pointer is filled with a pattern at startup.
+         * The high water mark is the first overwritten word, which is only searched when it is requested.
+         */
+        struct StackPaint
+        {
+            uint32_t *bottom = nullptr;
+            uint32_t words = 0; // still untouched
+        };
+        StackPaint _stackPaint;
     #ifdef OPENKNX_DUALCORE
-        volatile int32_t _freeStackMin1 = 0;
+        StackPaint _stackPaint1;
     #endif
+        void paintStack(StackPaint &paint);
+        int scanStack(StackPaint &paint);
 #endif
-#ifdef ARDUINO_ARCH_RP2040
-        volatile int32_t _freeStackMin = 0x2000;
+#ifdef ARDUINO_ARCH_ESP32
+        // the stack high water mark is tracked by freertos
+        TaskHandle_t _stackTask = nullptr;
     #ifdef OPENKNX_DUALCORE
-        volatile int32_t _freeStackMin1 = 0x2000;
+        TaskHandle_t _stackTask1 = nullptr;
     #endif
 #endif
 
         void initKnx();
 
         void processModulesLoop();
+        void processTasks();
         void registerCallbacks();
         void processRestoreSavePin();
         void initMemoryTimerInterrupt();
@@ -64,6 +86,9 @@ namespace OpenKNX
         void processPeriodicSave();
 #endif
 
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+        FunctionProperties _functionProperties;
+#endif
         bool processFunctionProperty(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t* data, uint8_t* resultData, uint8_t& resultLength);
         bool processFunctionPropertyState(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t* data, uint8_t* resultData, uint8_t& resultLength);
 
@@ -72,14 +97,54 @@ namespace OpenKNX
         Stat::RuntimeStat _runtimeConsole;
         Stat::RuntimeStat _runtimeKnxStack;
         Stat::RuntimeStat _runtimeModuleLoop;
+    #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        Stat::RuntimeStat _runtimeInputKo;
+    #endif
 #endif
 
 #ifdef BASE_StartupDelayBase
         uint32_t _startupDelay = 0;
         bool _firstStartup = true;
 #endif
+        // the startup delay is over - the jitter before the first module step is running
+        bool _startupDelayElapsed = false;
+        // public state: set with the first module step, so afterStartupDelay() is not true before the modules started
         bool _afterStartupDelay = false;
 
+        // module in loop/loop1 per core - afterStartupDelay() is only true for modules, which have started
+        static constexpr uint8_t NoModule = 0xFF;
+#ifdef ARDUINO_ARCH_RP2040
+        volatile uint8_t _loopModule[2] = {NoModule, NoModule};
+#else
+        uint8_t _loopModule = NoModule;
+#endif
+        bool moduleStarted(uint8_t module);
+
+        // stepwise processAfterStartupDelay of the modules
+        bool _startupCompleted = false;
+        uint8_t _startupModule = 0;
+        uint16_t _startupStep = 0;
+        uint32_t _startupNext = 0;
+        uint32_t _startupBegin = 0;
+        uint32_t _startupJitter = 0;
+        uint32_t startupJitter(uint32_t max);
+        void processStartupSteps();
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        KoRouting _inputKoRouting;
+        void dispatchInputKo(GroupObject& ko);
+#endif
+#ifdef OPENKNX_KO_BATCH
+        KoBatch _inputKoBatch;
+        void processInputKoBatch();
+#endif
+#ifdef OPENKNX_KO_QUEUE
+        volatile bool _inputKoQueueActive = false;
+        void initInputKoDispatch();
+        void queueInputKo(uint8_t moduleIndex, GroupObject& ko);
+        void processInputKoQueue(uint8_t moduleIndex);
+#endif
+
 #ifdef BASE_KoManualSave
         void processSaveKo(GroupObject& ko);
 #endif
@@ -101,13 +166,20 @@ namespace OpenKNX
         void loop1();
 #endif
 
+        /*
+         * true after the startup delay and the jitter, when the first module runs processAfterStartupDelayStep.
+         * Called in loop/loop1 of a module, it is only true after the first startup step of this module.
+         */
         bool afterStartupDelay();
+        /*
+         * All modules have finished their (stepwise) processAfterStartupDelay
+         */
+        bool startupCompleted();
         void processAfterStartupDelay();
         void skipLooptimeWarning();
         void restart();
 
         void collectHeapStats();
-        void collectStackStats();
         uint freeMemoryMin();
 #if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32)
         int freeStackMin();
@@ -123,11 +195,36 @@ namespace OpenKNX
         void processBeforeTablesUnload();
 #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
         void processInputKo(GroupObject& ko);
+
+        /*
+         * Register a range of KO numbers (asap) the module is interested in. Should be called in setup().
+         * After the first registration, the module only receives GroupObjects of its registered ranges.
+         * Modules without registered ranges receive all GroupObjects.
+         */
+        void registerInputKoRange(Module& module, uint16_t first, uint16_t last);
+        void showInputKoRouting();
+#endif
+#ifdef OPENKNX_KO_BATCH
+        void showInputKoBatch();
 #endif
         std::string logPrefix();
 
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+        /*
+         * Register handlers for a function property (objectIndex/propertyId) instead of
+         * implementing processFunctionProperty/processFunctionPropertyState in the module.
+         * A handler returning FunctionPropertyResult::Pending has to deliver its result later with completeFunctionProperty.
+         */
+        bool registerFunctionProperty(uint8_t objectIndex, uint8_t propertyId, FunctionPropertyHandler command, FunctionPropertyHandler state = nullptr);
+        bool completeFunctionProperty(uint8_t objectIndex, uint8_t propertyId, const uint8_t* resultData, uint8_t resultLength);
+#endif
+
+#ifdef OPENKNX_KO_QUEUE
+        void showInputKoQueue();
+#endif
 #ifdef OPENKNX_RUNTIME_STAT
         void showRuntimeStat(const bool stat = true, const bool hist = false);
+        bool showRuntimeStatStep(uint16_t step, const bool stat = true, const bool hist = false);
 #endif
     };
 } // namespace OpenKNX
@@ -1,22 +1,134 @@
 #include "OpenKNX/Console.h"
+#include "OpenKNX/ConsoleBuiltins.h"
 #include "OpenKNX/Facade.h"
 #include "OpenKNX/Flash/Driver.h"
 
 #ifdef ARDUINO_ARCH_RP2040
     #include "LittleFS.h"
+    #include <memory>
+    #include <vector>
 #endif
 
 namespace OpenKNX
 {
     void Console::loop()
     {
+#ifdef BASE_KoDiagnose
+        _diagnoseProtocol.loop();
+#endif
+
+        // no input is processed until the running output is finished
+        if (_job)
+        {
+            processJob();
+            return;
+        }
+
+#ifdef ARDUINO_ARCH_RP2040
+    #ifdef OPENKNX_CONSOLE_AUTORUN
+        if (!_autorunChecked && openknx.afterStartupDelay())
+        {
+            _autorunChecked = true;
+            if (LittleFS.exists(OPENKNX_CONSOLE_AUTORUN))
+                _script.start(OPENKNX_CONSOLE_AUTORUN, OPENKNX_CONSOLE_AUTORUN_LOG);
+        }
+    #endif
+
+        // one command of a script per loop - the input is still read, so "run stop" or ctrl-c stop the script
+        if (_script.active())
+        {
+            _script.loop();
+
+            // the output of the command is finished first
+            if (_job)
+                return;
+        }
+#endif
+
         if (OPENKNX_LOGGER_DEVICE.available())
             processSerialInput();
     }
 
+    void Console::startJob(ConsoleJob job)
+    {
+        // only one job at a time - finish the previous one
+        if (_job) finishJob();
+
+        _job = job;
+        _jobStep = 0;
+        _jobNumber++;
+        _jobCapture = openknx.logger.captured();
+    }
+
+    bool Console::jobActive()
+    {
+        return (bool)_job;
+    }
+
+    uint16_t Console::jobNumber()
+    {
+        return _jobNumber;
+    }
+
+    Print* Console::jobCapture()
+    {
+        return _job ? _jobCapture : nullptr;
+    }
+
+    /*
+     * Process at least one step of the job and continue as long as free loop time is left
+     */
+    void Console::processJob()
+    {
+        do
+        {
+            logBegin();
+            Print* previousCapture = openknx.logger.capture(_jobCapture);
+            const bool more = _job(_jobStep++);
+            openknx.logger.capture(previousCapture);
+            logEnd();
+
+            if (!more)
+            {
+                _job = nullptr;
+                return;
+            }
+        }
+        while (openknx.freeLoopTime());
+    }
+
+    void Console::finishJob()
+    {
+        if (!_job) return;
+
+        logBegin();
+        Print* previousCapture = openknx.logger.capture(_jobCapture);
+        while (_job(_jobStep++))
+            ;
+        openknx.logger.capture(previousCapture);
+        logEnd();
+        _job = nullptr;
+    }
+
+    /*
+     * Helper to show a stepwise output synchronously
+     */
+    void Console::runSteps(ConsoleJob job)
+    {
+        logBegin();
+        uint16_t step = 0;
+        while (job(step++))
+            ;
+        logEnd();
+    }
+
 #ifdef BASE_KoDiagnose
     void Console::writeDiagnoseKo(const char* message, va_list& values)
     {
+        // the answer of a framed command contains the console output, the short answer is not needed
+        if (_diagnoseProtocol.capturing())
+            return;
+
         char buffer[15] = {}; // Last byte must be zero!
         uint8_t len = vsnprintf(buffer, 15, message, values);
 
@@ -52,6 +164,12 @@ namespace OpenKNX
         if (_diagnoseKoOutput)
             return;
 
+        if (DiagnoseProtocol::isFrame(ko.valueRef()))
+        {
+            _diagnoseProtocol.processFrame(ko.valueRef());
+            return;
+        }
+
         // quick-fix to ensure \0 at end of 14 char strings
         // TODO cleanup implementation and read DPT16.001
         char cmdBuf[15] = {};
@@ -72,192 +190,165 @@ namespace OpenKNX
 #endif
 
     bool Console::processCommand(std::string cmd, bool diagnoseKo /* = false */)
+    {
+        return processCommand(cmd.c_str(), diagnoseKo);
+    }
+
+    bool Console::processCommand(const char* cmd, bool diagnoseKo /* = false */)
     {
         openknx.common.skipLooptimeWarning();
-#if MASK_VERSION == 0x07B0
-        TpUartDataLinkLayer* dll = knx.bau().getDataLinkLayer();
-#elif MASK_VERSION == 0x091A
-        TpUartDataLinkLayer* dll = knx.bau().getSecondaryDataLinkLayer();
-#endif
 
-        if (!diagnoseKo && (cmd == "i" || cmd == "info"))
-        {
-            showInformations();
-        }
-        else if (!diagnoseKo && (cmd == "h" || cmd == "help"))
-        {
-            showHelp();
-        }
-        else if (!diagnoseKo && (cmd == "v" || cmd == "versions"))
-        {
-            showVersions();
-        }
-        else if (cmd == "m" || cmd == "mem" || cmd == "memory")
-        {
-            showMemory(diagnoseKo);
-        }
-        else if (!diagnoseKo && (cmd == "p" || cmd == "prog"))
-        {
-            knx.toggleProgMode();
-        }
-        else if ((cmd == "u" || cmd == "uptime"))
-        {
-            showUptime(diagnoseKo);
-        }
-        else if (!diagnoseKo && (cmd == "sleep"))
-        {
-            sleep();
-        }
-        else if (!diagnoseKo && (cmd == "r" || cmd == "restart"))
-        {
-            delay(20);
-            openknx.restart();
-        }
-        else if (!diagnoseKo && (cmd == "fatal"))
-        {
-            openknx.hardware.fatalError(5, "Test with 5x blinking");
-        }
-        else if (!diagnoseKo && (cmd == "powerloss"))
-        {
-            openknx.common.triggerSavePin();
-        }
-        else if (!diagnoseKo && (cmd == "s" || cmd == "w" || cmd == "save"))
+        // split the words in place of a copy, so the handlers get the arguments without further copies
+        char line[CONSOLE_COMMAND_SIZE + 1] = {};
+        const char* tokens[OPENKNX_CONSOLE_MAX_TOKENS];
+        uint8_t tokenCount = 0;
+        if (strlen(cmd) <= CONSOLE_COMMAND_SIZE)
         {
-            openknx.flash.save();
+            strcpy(line, cmd);
+            tokenCount = tokenize(line, tokens);
         }
-        else if (cmd == "flash knx")
-        {
-            showMemoryContent(openknx.knxFlash.flashAddress(), openknx.knxFlash.size());
-        }
-        else if (cmd == "flash openknx")
-        {
-            showMemoryContent(openknx.openknxFlash.flashAddress(), openknx.openknxFlash.size());
-        }
-        else if (cmd.substr(0, 6) == "mem 0x" && cmd.length() > 6)
-        {
-            std::string addrstr = cmd.substr(6, cmd.length() - 6);
-            uint32_t addr = std::stoi(addrstr, nullptr, 16);
-            showMemoryContent((uint8_t*)addr, 0x40);
-        }
-#ifndef ARDUINO_ARCH_SAMD
-        else if ((!diagnoseKo && (cmd.compare(0, 3, "dw ") == 0 || cmd.compare(0, 3, "aw ") == 0)) ||
-                 (cmd.compare(0, 3, "dr ") == 0 || cmd.compare(0, 3, "ar ") == 0))
-        {
-            processPinCommand(cmd);
-        }
-        else if (!diagnoseKo && (cmd.rfind("dwon ", 0) == 0 || cmd.rfind("dwoff ", 0) == 0))
+        else
         {
-            processPinCommand("dw " + cmd.substr(((cmd.rfind("dwon ", 0) == 0) ? 5 : 6)) + (cmd.rfind("dwon ", 0) == 0 ? " 1" : " 0"));
+            // can not be split without truncation - only the modules get the full line
+            openknx.logger.logWithPrefixAndValues("Console", "Command too long for the command table (max %u)", CONSOLE_COMMAND_SIZE);
         }
-#endif
 
-#ifdef OPENKNX_RUNTIME_STAT
-        else if (!diagnoseKo && (cmd == "runtime"))
-        {
-            openknx.common.showRuntimeStat();
-        }
-        else if (!diagnoseKo && (cmd == "runtime hist"))
-        {
-            openknx.common.showRuntimeStat(false, true);
-        }
-        else if (!diagnoseKo && (cmd == "runtime full"))
-        {
-            openknx.common.showRuntimeStat(true, true);
-        }
-#endif
-#ifdef OPENKNX_WATCHDOG
-        else if (cmd == "watchdog")
-        {
-            showWatchdogResets(diagnoseKo);
-        }
-#endif
-#ifdef ARDUINO_ARCH_RP2040
-        else if (!diagnoseKo && (cmd == "fs" || cmd == "files"))
-        {
-            showFilesystem();
-        }
-        else if (!diagnoseKo && (cmd == "file dummy"))
-        {
-            File file = LittleFS.open("dummy.dummy", "a");
-            file.seek(rp2040.hwrand32());
-            file.write("DUMMY");
-            file.close();
-            showFilesystem();
-        }
-        else if (!diagnoseKo && (cmd == "bootloader"))
-        {
-            resetToBootloader();
-        }
-#endif
-        else if (!diagnoseKo && (cmd == "erase knx"))
-        {
-            erase(EraseMode::KnxFlash);
-        }
-        else if (!diagnoseKo && (cmd == "erase openknx"))
-        {
-            erase(EraseMode::OpenKnxFlash);
-        }
-#ifdef ARDUINO_ARCH_RP2040
-        else if (!diagnoseKo && (cmd == "erase files"))
-        {
-            erase(EraseMode::Filesystem);
-        }
-#endif
-        else if (!diagnoseKo && (cmd == "erase all"))
-        {
-            erase(EraseMode::All);
-        }
-#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
-        else if (cmd.compare("bcu") == 0)
-        {
-            logInfo("BCU<Status>", "%s", dll->isConnected() ? "Connected" : "Disconnected");
-            logInfo("BCU<Received>", "Processed: %i - Ignored: %i - Invalid: %i - Unknown: %i",
-                    dll->getRxProcessdFrameCounter(), dll->getRxIgnoredFrameCounter(), dll->getRxInvalidFrameCounter(), dll->getRxUnknownControlCounter());
-            logInfo("BCU<Transmitted>", "Processed: %i/%i", dll->getTxProcessedFrameCounter(), dll->getTxFrameCounter());
-            return true;
-        }
-        else if (cmd.compare("bcu mon") == 0)
+        if (tokenCount > 0)
         {
-            logInfo("KNX<BCU>", "Start BCU monitoring");
-            dll->monitor();
-            return true;
+            // find the deepest matching subcommand
+            uint8_t depth = 1;
+            const ConsoleCommand* command = findRootCommand(tokens[0]);
+            while (command != nullptr && depth < tokenCount)
+            {
+                const ConsoleCommand* child = findCommand(command->children, command->childCount, tokens[depth]);
+                if (child == nullptr) break;
+
+                command = child;
+                depth++;
+            }
+
+            if (command != nullptr && command->handler != nullptr && (!diagnoseKo || (command->flags & ConsoleCommandDiagnoseKo)))
+            {
+                ConsoleContext context = {command, diagnoseKo, (uint8_t)(tokenCount - depth), tokens + depth};
+                if (command->handler(context))
+                    return true;
+            }
         }
-        else if (cmd.compare("bcu rst") == 0)
+
+        // check modules for command
+        const std::string command = cmd;
+        for (uint8_t i = 0; i < openknx.modules.count; i++)
+            if (openknx.modules.list[i]->processCommand(command, diagnoseKo))
+                return true;
+
+        return false;
+    }
+
+    uint8_t Console::tokenize(char* line, const char** tokens)
+    {
+        uint8_t count = 0;
+        char* current = line;
+        while (*current != '\0')
         {
-            logInfo("KNX<BCU>", "Reset BCU");
-            dll->reset();
-            return true;
+            // skip separators
+            if (*current == ' ')
+            {
+                *current++ = '\0';
+                continue;
+            }
+
+            // too many words
+            if (count >= OPENKNX_CONSOLE_MAX_TOKENS)
+                return 0;
+
+            tokens[count++] = current;
+            while (*current != '\0' && *current != ' ')
+                current++;
         }
-    #ifdef NCN5120
-        else if (cmd.compare("bcu poff") == 0)
-        {
-            logInfo("KNX<BCU>", "Switch off VCC2");
-            dll->powerControl(false);
+        return count;
+    }
+
+    bool Console::matchCommand(const ConsoleCommand& command, const char* word)
+    {
+        if (strcmp(command.name, word) == 0)
             return true;
-        }
-        else if (cmd.compare("bcu pon") == 0)
+
+        if (command.aliases == nullptr)
+            return false;
+
+        // aliases are separated by comma with optional spaces
+        const size_t length = strlen(word);
+        const char* alias = command.aliases;
+        while (*alias != '\0')
         {
-            logInfo("KNX<BCU>", "Switch on VCC2");
-            dll->powerControl(true);
-            return true;
+            while (*alias == ' ' || *alias == ',')
+                alias++;
+
+            const char* aliasEnd = alias;
+            while (*aliasEnd != '\0' && *aliasEnd != ',' && *aliasEnd != ' ')
+                aliasEnd++;
+
+            if ((size_t)(aliasEnd - alias) == length && strncmp(alias, word, length) == 0)
+                return true;
+
+            alias = aliasEnd;
         }
-    #endif
-#endif
-        else
+        return false;
+    }
+
+    const ConsoleCommand* Console::findCommand(const ConsoleCommand* commands, uint8_t count, const char* word)
+    {
+        for (uint8_t i = 0; i < count; i++)
+            if (matchCommand(commands[i], word))
+                return &commands[i];
+
+        return nullptr;
+    }
+
+    const ConsoleCommand* Console::findRootCommand(const char* word)
+    {
+        const ConsoleCommand* command = findCommand(ConsoleBuiltins::commands, ConsoleBuiltins::count, word);
+        if (command != nullptr)
+            return command;
+
+        for (uint8_t i = 0; i < _commandCount; i++)
+            if (matchCommand(*_commands[i], word))
+                return _commands[i];
+
+        return nullptr;
+    }
+
+    bool Console::registerCommand(const ConsoleCommand& command)
+    {
+        if (_commandCount >= OPENKNX_CONSOLE_MAX_COMMANDS)
         {
-            // check modules for command
-            for (uint8_t i = 0; i < openknx.modules.count; i++)
-                if (openknx.modules.list[i]->processCommand(cmd, diagnoseKo))
-                    return true;
+            openknx.logger.logWithPrefixAndValues("Console", "Too many commands (max %u) - %s is not registered", OPENKNX_CONSOLE_MAX_COMMANDS, command.name);
             return false;
         }
+
+        _commands[_commandCount++] = &command;
         return true;
     }
 
+    /*
+     * Process all received chars within OPENKNX_CONSOLE_INPUT_BUDGET, so pasted commands are handled at once
+     */
     void Console::processSerialInput()
     {
-        const uint8_t current = OPENKNX_LOGGER_DEVICE.read();
+        const uint32_t start = micros();
+        do
+        {
+            if (!processInputChar(OPENKNX_LOGGER_DEVICE.read()))
+                break;
+        }
+        while (OPENKNX_LOGGER_DEVICE.available() && !delayCheckMicros(start, OPENKNX_CONSOLE_INPUT_BUDGET));
+    }
 
+    /*
+     * @return false if the processing of further chars should be stopped (command executed)
+     */
+    bool Console::processInputChar(uint8_t current)
+    {
         // Magic byte for save data during firmware upgrade
         if (current == 0x7)
         {
@@ -269,100 +360,224 @@ namespace OpenKNX
             openknx.restart();
         }
 
+        const uint8_t last = _consoleCharLast;
+        _consoleCharLast = current;
+
+#ifdef ARDUINO_ARCH_RP2040
+        // ctrl-c stops a running script and clears the input
+        if (current == 0x03)
+        {
+            _script.stop();
+            setPrompt("");
+            return false;
+        }
+#endif
+
+        // escape sequences: arrow up "ESC [ A" and arrow down "ESC [ B", others are ignored
+        if (_escapeState == 0 && current == 0x1B)
+        {
+            _escapeState = 1;
+            return true;
+        }
+        if (_escapeState == 1)
+        {
+            _escapeState = (current == '[') ? 2 : 0;
+            return true;
+        }
+        if (_escapeState == 2)
+        {
+            // parameters of the sequence
+            if (current >= 0x30 && current <= 0x3F)
+                return true;
+
+            _escapeState = 0;
+#if OPENKNX_CONSOLE_HISTORY > 0
+            if (current == 'A' || current == 'B')
+                recallHistory(current == 'A');
+#endif
+            return true;
+        }
+
         if (current == '\r' || current == '\n')
         {
-            if (_consoleCharLast == '\r' && current == '\n')
-            {
-                _consoleCharLast = current;
-                return;
-            }
+            if (last == '\r' && current == '\n')
+                return true;
 
             openknx.logger.log(prompt);
-            if (strlen(prompt) > 0)
+            if (_promptLength > 0)
             {
+#if OPENKNX_CONSOLE_HISTORY > 0
+                addHistory();
+#endif
                 if (!processCommand(prompt))
                 {
                     // Command not found
                     openknx.logger.logWithValues("%s: command not found", prompt);
                 }
             }
-            memset(prompt, 0, CONSOLE_INPUT_SIZE); // Reset Promptbuffer
+            setPrompt("");
+            return false;
         }
 
-        if (current == '\b' && strlen(prompt) > 0)
-            prompt[strlen(prompt) - 1] = 0x0;
+        // only the changed chars are printed
+        if ((current == '\b' || current == 0x7F) && _promptLength > 0)
+        {
+            prompt[--_promptLength] = 0x0;
+#ifndef OPENKNX_RTT
+            logBegin();
+            OPENKNX_LOGGER_DEVICE.print("\b \b");
+            logEnd();
+#endif
+        }
+        else if (_promptLength < CONSOLE_INPUT_SIZE && current >= 32 && current <= 126) // Max. printables chars allowed
+        {
+            prompt[_promptLength++] = current;
+#ifndef OPENKNX_RTT
+            logBegin();
+            OPENKNX_LOGGER_DEVICE.print((char)current);
+            logEnd();
+#endif
+        }
 
-        if (strlen(prompt) < CONSOLE_INPUT_SIZE && current >= 32 && current <= 126) // Max. printables chars allowed
-            prompt[strlen(prompt)] = current;
+        return true;
+    }
 
+    void Console::setPrompt(const char* text)
+    {
+        memset(prompt, 0, CONSOLE_INPUT_SIZE + 1);
+        strncpy(prompt, text, CONSOLE_INPUT_SIZE);
+        _promptLength = strlen(prompt);
+#if OPENKNX_CONSOLE_HISTORY > 0
+        _historyPosition = 0;
+#endif
         openknx.logger.printPrompt();
-        _consoleCharLast = current;
     }
 
-    void Console::showInformations()
+#if OPENKNX_CONSOLE_HISTORY > 0
+    void Console::addHistory()
     {
-#ifdef OPENKNX_DUALCORE
-        const char* cpuMode = openknx.usesDualCore() ? "Dual-Core" : "Single-Core";
-#else
-        const char* cpuMode = "Single-Core";
+        // skip repeated commands
+        const uint8_t previous = (_historyHead + OPENKNX_CONSOLE_HISTORY - 1) % OPENKNX_CONSOLE_HISTORY;
+        if (_historyCount > 0 && strcmp(_history[previous], prompt) == 0)
+            return;
+
+        strcpy(_history[_historyHead], prompt);
+        _historyHead = (_historyHead + 1) % OPENKNX_CONSOLE_HISTORY;
+        if (_historyCount < OPENKNX_CONSOLE_HISTORY)
+            _historyCount++;
+    }
+
+    void Console::recallHistory(bool older)
+    {
+        uint8_t position = _historyPosition;
+        if (older && position < _historyCount)
+            position++;
+        else if (!older && position > 0)
+            position--;
+        else
+            return;
+
+        if (position == 0)
+            setPrompt("");
+        else
+            setPrompt(_history[(_historyHead + OPENKNX_CONSOLE_HISTORY - position) % OPENKNX_CONSOLE_HISTORY]);
+
+        // setPrompt resets the position
+        _historyPosition = position;
+    }
 #endif
 
-        logBegin();
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("================================================================================");
-        openknx.logger.color(0);
-        openknx.logger.log("");
-        openknx.logger.log("        \x1B[90mOpen \x1B[32m#\x1B[0m           OpenKNX.de");
-        openknx.logger.log("        \x1B[32m+----+\x1B[0m");
-        openknx.logger.log("        \x1B[32m# \x1B[37mKNX\x1B[0m            wiki.openknx.de - forum.openknx.de");
-        openknx.logger.log("");
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("======================== Information ===========================================");
-        openknx.logger.color(0);
+    void Console::showInformations()
+    {
+        runSteps([](uint16_t step) -> bool { return openknx.console.showInformationsStep(step); });
+    }
 
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("Device");
-        openknx.logger.color(0);
+    bool Console::showInformationsStep(uint16_t step)
+    {
+        // modules are shown one per step after the common information
+        if (step >= 3)
+        {
+            const uint16_t module = step - 3;
+            if (module < openknx.modules.count)
+            {
+                openknx.modules.list[module]->showInformations();
+                return true;
+            }
+
+            openknx.logger.log("--------------------------------------------------------------------------------");
+            openknx.logger.log("");
+            return false;
+        }
+
+        if (step == 0)
+        {
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("================================================================================");
+            openknx.logger.color(0);
+            openknx.logger.log("");
+            openknx.logger.log("        \x1B[90mOpen \x1B[32m#\x1B[0m           OpenKNX.de");
+            openknx.logger.log("        \x1B[32m+----+\x1B[0m");
+            openknx.logger.log("        \x1B[32m# \x1B[37mKNX\x1B[0m            wiki.openknx.de - forum.openknx.de");
+            openknx.logger.log("");
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("======================== Information ===========================================");
+            openknx.logger.color(0);
+
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("Device");
+            openknx.logger.color(0);
 #ifdef DEVICE_ID
-        openknx.logger.logWithPrefix("ID", DEVICE_ID);
+            openknx.logger.logWithPrefix("ID", DEVICE_ID);
 #endif
 #ifdef DEVICE_NAME
-        openknx.logger.logWithPrefix("Name", DEVICE_NAME);
+            openknx.logger.logWithPrefix("Name", DEVICE_NAME);
 #elif defined(HARDWARE_NAME)
-        openknx.logger.logWithPrefix("Name", HARDWARE_NAME);
+            openknx.logger.logWithPrefix("Name", HARDWARE_NAME);
 #endif
-        openknx.logger.logWithPrefix("Serial number", openknx.info.humanSerialNumber().c_str());
+            openknx.logger.logWithPrefix("Serial number", openknx.info.humanSerialNumber().c_str());
+            return true;
+        }
 
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("Firmware");
-        openknx.logger.color(0);
+        if (step == 1)
+        {
+#ifdef OPENKNX_DUALCORE
+            const char* cpuMode = openknx.usesDualCore() ? "Dual-Core" : "Single-Core";
+#else
+            const char* cpuMode = "Single-Core";
+#endif
+
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("Firmware");
+            openknx.logger.color(0);
 #ifdef FIRMWARE_VARIANT
-        openknx.logger.logWithPrefixAndValues("  Name", "%s  (%s)", openknx.info.firmwareName().c_str(), FIRMWARE_VARIANT);
+            openknx.logger.logWithPrefixAndValues("  Name", "%s  (%s)", openknx.info.firmwareName().c_str(), FIRMWARE_VARIANT);
 #else
-        openknx.logger.logWithPrefix("Name", openknx.info.firmwareName().c_str());
+            openknx.logger.logWithPrefix("Name", openknx.info.firmwareName().c_str());
 #endif
-        openknx.logger.logWithPrefix("Version", openknx.info.humanFirmwareVersion().c_str());
-        openknx.logger.logWithPrefix("Number", openknx.info.humanFirmwareNumber().c_str());
+            openknx.logger.logWithPrefix("Version", openknx.info.humanFirmwareVersion().c_str());
+            openknx.logger.logWithPrefix("Number", openknx.info.humanFirmwareNumber().c_str());
 #if MASK_VERSION == 0x07B0
-        openknx.logger.logWithPrefixAndValues("KNX-Type", "TP (%04X)", MASK_VERSION);
+            openknx.logger.logWithPrefixAndValues("KNX-Type", "TP (%04X)", MASK_VERSION);
 #elif MASK_VERSION == 0x57B0
-        openknx.logger.logWithPrefixAndValues("KNX-Type", "IP (%04X)", MASK_VERSION);
+            openknx.logger.logWithPrefixAndValues("KNX-Type", "IP (%04X)", MASK_VERSION);
 #elif MASK_VERSION == 0x091A
-        openknx.logger.logWithPrefixAndValues("KNX-Type", "Router (%04X)", MASK_VERSION);
+            openknx.logger.logWithPrefixAndValues("KNX-Type", "Router (%04X)", MASK_VERSION);
 #else
-        openknx.logger.logWithPrefixAndValues("KNX-Type", "%04X", MASK_VERSION);
+            openknx.logger.logWithPrefixAndValues("KNX-Type", "%04X", MASK_VERSION);
 #endif
-        if (openknx.hardware.cpuTemperature() > 0)
-            openknx.logger.logWithPrefixAndValues("CPU-Mode", "%s (Temperature %.1f °C)", cpuMode, openknx.hardware.cpuTemperature());
-        else
-            openknx.logger.logWithPrefixAndValues("CPU-Mode", "%s", cpuMode);
-
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("Programming");
-        openknx.logger.color(0);
-        openknx.logger.logWithPrefixAndValues("Address", "%s (%s)", openknx.info.humanIndividualAddress().c_str(), knx.configured() ? "Configured" : "Unconfigured");
-        openknx.logger.logWithPrefix("Version", openknx.info.humanApplicationVersion().c_str());
-        openknx.logger.logWithPrefix("Number", openknx.info.humanApplicationNumber().c_str());
+            if (openknx.hardware.cpuTemperature() > 0)
+                openknx.logger.logWithPrefixAndValues("CPU-Mode", "%s (Temperature %.1f °C)", cpuMode, openknx.hardware.cpuTemperature());
+            else
+                openknx.logger.logWithPrefixAndValues("CPU-Mode", "%s", cpuMode);
+
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("Programming");
+            openknx.logger.color(0);
+            openknx.logger.logWithPrefixAndValues("Address", "%s (%s)", openknx.info.humanIndividualAddress().c_str(), knx.configured() ? "Configured" : "Unconfigured");
+            openknx.logger.logWithPrefix("Version", openknx.info.humanApplicationVersion().c_str());
+            openknx.logger.logWithPrefix("Number", openknx.info.humanApplicationNumber().c_str());
+            return true;
+        }
 
         openknx.logger.color(CONSOLE_HEADLINE_COLOR);
         openknx.logger.log("Runtime");
@@ -378,13 +593,7 @@ namespace OpenKNX
 #else
         openknx.logger.logWithPrefixAndValues("Watchdog", "Unsupported");
 #endif
-
-        for (uint8_t i = 0; i < openknx.modules.count; i++)
-            openknx.modules.list[i]->showInformations();
-
-        openknx.logger.log("--------------------------------------------------------------------------------");
-        openknx.logger.log("");
-        logEnd();
+        return true;
     }
 
 #ifdef OPENKNX_WATCHDOG
@@ -407,123 +616,151 @@ namespace OpenKNX
 #endif
 
 #ifdef ARDUINO_ARCH_RP2040
-    void Console::showFilesystem()
+    /*
+     * State of a stepwise filesystem listing. Directories are listed one entry per step,
+     * subdirectories are queued and listed afterwards.
+     */
+    struct FilesystemListing
     {
-        logBegin();
-        openknx.logger.log("");
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("======================== Filesystem ============================================");
+        std::vector<std::string> pending;
+        std::string path;
+        Dir directory;
+        bool open = false;
+    };
 
-        openknx.logger.color(0);
-        showFilesystemDirectory("/");
-        openknx.logger.log("--------------------------------------------------------------------------------");
-        logEnd();
+    void Console::showFilesystem()
+    {
+        FilesystemListing listing;
+        runSteps([&listing](uint16_t step) -> bool { return openknx.console.showFilesystemStep(step, listing); });
     }
 
-    void Console::showFilesystemDirectory(std::string path)
+    void Console::startFilesystemJob()
     {
-        logBegin();
-        openknx.logger.logWithPrefixAndValues("Filesystem", "%s", path.c_str());
+        std::shared_ptr<FilesystemListing> listing = std::make_shared<FilesystemListing>();
+        startJob([listing](uint16_t step) -> bool { return openknx.console.showFilesystemStep(step, *listing); });
+    }
 
-        Dir directory = LittleFS.openDir(path.c_str());
+    bool Console::showFilesystemStep(uint16_t step, FilesystemListing& listing)
+    {
+        if (step == 0)
+        {
+            openknx.logger.log("");
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("======================== Filesystem ============================================");
+            openknx.logger.color(0);
+            listing.pending.push_back("/");
+            return true;
+        }
 
-        while (directory.next())
+        if (!listing.open)
         {
-            std::string full = path + directory.fileName().c_str();
-            if (directory.isDirectory())
-                showFilesystemDirectory(full + "/");
-            else
+            if (listing.pending.empty())
             {
-                openknx.logger.logWithPrefixAndValues("Filesystem", "%s (%i bytes)", full.c_str(), directory.fileSize());
+                openknx.logger.log("--------------------------------------------------------------------------------");
+                return false;
             }
+
+            listing.path = listing.pending.front();
+            listing.pending.erase(listing.pending.begin());
+            listing.directory = LittleFS.openDir(listing.path.c_str());
+            listing.open = true;
+            openknx.logger.logWithPrefixAndValues("Filesystem", "%s", listing.path.c_str());
+            return true;
         }
-        logEnd();
+
+        if (!listing.directory.next())
+        {
+            listing.open = false;
+            return true;
+        }
+
+        std::string full = listing.path + listing.directory.fileName().c_str();
+        if (listing.directory.isDirectory())
+            listing.pending.push_back(full + "/");
+        else
+            openknx.logger.logWithPrefixAndValues("Filesystem", "%s (%i bytes)", full.c_str(), listing.directory.fileSize());
+
+        return true;
     }
 #endif
 
     void Console::showVersions()
     {
-        logBegin();
-        openknx.logger.log("");
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("======================== Versions ==============================================");
-        openknx.logger.color(0);
+        runSteps([](uint16_t step) -> bool { return openknx.console.showVersionsStep(step); });
+    }
 
-        openknx.logger.logWithPrefix("This Firmware", openknx.info.humanFirmwareVersion(true));
-        openknx.logger.logWithPrefix("KNX", KNX_Version);
-        openknx.logger.logWithPrefix(openknx.common.logPrefix(), MODULE_Common_Version);
-        for (uint8_t i = 0; i < openknx.modules.count; i++)
+    bool Console::showVersionsStep(uint16_t step)
+    {
+        if (step == 0)
+        {
+            openknx.logger.log("");
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("======================== Versions ==============================================");
+            openknx.logger.color(0);
+
+            openknx.logger.logWithPrefix("This Firmware", openknx.info.humanFirmwareVersion(true));
+            openknx.logger.logWithPrefix("KNX", KNX_Version);
+            openknx.logger.logWithPrefix(openknx.common.logPrefix(), MODULE_Common_Version);
+            return true;
+        }
+
+        const uint16_t module = step - 1;
+        if (module < openknx.modules.count)
         {
-            if (openknx.modules.list[i]->version().empty()) continue;
+            if (!openknx.modules.list[module]->version().empty())
+                openknx.logger.logWithPrefix(openknx.modules.list[module]->name().c_str(), openknx.modules.list[module]->version().c_str());
 
-            openknx.logger.logWithPrefix(openknx.modules.list[i]->name().c_str(), openknx.modules.list[i]->version().c_str());
+            return true;
         }
+
         openknx.logger.log("--------------------------------------------------------------------------------");
         openknx.logger.logWithPrefix("Builddate", __DATE__);
         openknx.logger.logWithPrefix("Buildtime", __TIME__);
         openknx.logger.log("--------------------------------------------------------------------------------");
-        logEnd();
+        return false;
     }
 
     void Console::showHelp()
     {
-        logBegin();
-        openknx.logger.log("");
-        openknx.logger.color(CONSOLE_HEADLINE_COLOR);
-        openknx.logger.log("======================== Help ==================================================");
-        openknx.logger.color(0);
-        openknx.logger.log("Command(s)               Description");
-        printHelpLine("help, h", "Show this help");
-        printHelpLine("info, i", "Show general information");
-        printHelpLine("uptime, u", "Show uptime");
-        printHelpLine("version, v", "Show compiled versions");
-        printHelpLine("memory, mem", "Show memory usage");
-        printHelpLine("mem 0xXXXXXXXX", "Show memory content (64byte) starting at 0xXXXXXXXX");
-        printHelpLine("flash knx", "Show knx flash content");
-        printHelpLine("flash openknx", "Show openknx flash content");
-#ifdef ARDUINO_ARCH_RP2040
-        printHelpLine("files, fs", "Show files on filesystem");
-#endif
-#ifdef OPENKNX_RUNTIME_STAT
-        printHelpLine("runtime", "Show runtime statistics (Short statistic)");
-        printHelpLine("runtime hist", "Show runtime histogram");
-        printHelpLine("runtime full", "Show runtime statistics and histogram");
-#endif
-        printHelpLine("restart, r", "Restart the device");
-        printHelpLine("prog, p", "Toggle the ProgMode");
-        printHelpLine("save, s, w", "Save data in Flash");
-        printHelpLine("sleep", "Sleep for up to 20 seconds");
-        printHelpLine("fatal", "Trigger a FatalError");
-        printHelpLine("powerloss", "Trigger a PowerLoss (SavePin)");
-#ifdef OPENKNX_WATCHDOG
-        printHelpLine("watchdog", "Show restart count by watchdog");
-#endif
-        printHelpLine("erase knx", "Erase knx parameters");
-        printHelpLine("erase openknx", "Erase openknx module data");
-#ifdef ARDUINO_ARCH_RP2040
-        printHelpLine("erase files", "Erase filesystem");
-        printHelpLine("erase all", "Erase all");
-        printHelpLine("bootloader", "Reset into Bootloader Mode");
-#endif
-#ifndef ARDUINO_ARCH_SAMD
-        printHelpLine("dwon <pin>", "Write digital pin to HIGH");
-        printHelpLine("dwoff <pin>", "Write digital pin to LOW");
-        printHelpLine("dw <pin> 0-1", "Write digital pin");
-        printHelpLine("dr <pin>", "Read digital pin");
-        printHelpLine("aw <pin> 0-4096", "Write analog pin");
-        printHelpLine("ar <pin>", "Read analog pin");
-#endif
-#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
-        printHelpLine("bcu", "Show BCU status");
-        printHelpLine("bcu mon", "Start BCU monitoring");
-        printHelpLine("bcu rst", "Reset BCU");
-#endif
+        runSteps([](uint16_t step) -> bool { return openknx.console.showHelpStep(step); });
+    }
 
-        for (uint8_t i = 0; i < openknx.modules.count; i++)
-            openknx.modules.list[i]->showHelp();
+    bool Console::showHelpStep(uint16_t step)
+    {
+        if (step == 0)
+        {
+            openknx.logger.log("");
+            openknx.logger.color(CONSOLE_HEADLINE_COLOR);
+            openknx.logger.log("======================== Help ==================================================");
+            openknx.logger.color(0);
+            openknx.logger.log("Command(s)               Description");
+            return true;
+        }
+
+        // one command (with subcommands) or module per step
+        uint16_t index = step - 1;
+        if (index < ConsoleBuiltins::count)
+        {
+            printHelpCommand(ConsoleBuiltins::commands[index]);
+            return true;
+        }
+
+        index -= ConsoleBuiltins::count;
+        if (index < _commandCount)
+        {
+            printHelpCommand(*_commands[index]);
+            return true;
+        }
+
+        index -= _commandCount;
+        if (index < openknx.modules.count)
+        {
+            openknx.modules.list[index]->showHelp();
+            return true;
+        }
 
         openknx.logger.log("--------------------------------------------------------------------------------");
-        logEnd();
+        return false;
     }
 
     void Console::sleep()
@@ -593,35 +830,55 @@ namespace OpenKNX
     }
 
     void Console::showMemoryContent(uint8_t* start, uint32_t size)
+    {
+        uint8_t* position = start;
+        runSteps([start, size, &position](uint16_t step) -> bool { return openknx.console.showMemoryContentStep(step, start, size, position); });
+    }
+
+    void Console::startMemoryContentJob(uint8_t* start, uint32_t size)
+    {
+        uint8_t* position = start;
+        startJob([start, size, position](uint16_t step) mutable -> bool { return openknx.console.showMemoryContentStep(step, start, size, position); });
+    }
+
+    bool Console::showMemoryContentStep(uint16_t step, uint8_t* start, uint32_t size, uint8_t*& position)
     {
         const size_t lineLen = 16;
         uint8_t* end = start + size - (size % lineLen);
 
-        logBegin();
-        openknx.logger.logWithPrefixAndValues("Memory content", "Address 0x%08X - Size: 0x%04X (%d bytes)", start, size, size);
-        for (uint8_t* linePtr = start; linePtr < end; linePtr += lineLen)
+        if (step == 0)
+        {
+            openknx.logger.logWithPrefixAndValues("Memory content", "Address 0x%08X - Size: 0x%04X (%d bytes)", start, size, size);
+            return true;
+        }
+
+        if (position < end)
         {
             // normale output
-            showMemoryLine(linePtr, lineLen, start);
+            showMemoryLine(position, lineLen, start);
 
             // skip repeated lines and show repetition count only
             int repeatCount = 0;
-            while (linePtr + lineLen < end && memcmp(linePtr, linePtr + lineLen, lineLen) == 0)
+            while (position + lineLen < end && memcmp(position, position + lineLen, lineLen) == 0)
             {
                 repeatCount++;
-                linePtr += lineLen;
+                position += lineLen;
             }
             if (repeatCount > 0)
             {
                 openknx.logger.logWithPrefixAndValues("", "%ix (repetitions of previous line)", repeatCount);
             }
+
+            position += lineLen;
+            return true;
         }
+
         // incomplete last line (edge case)
         if (end != start + size)
         {
             showMemoryLine(end, (start + size) - end, start);
         }
-        logEnd();
+        return false;
     }
 
     void Console::showMemoryLine(uint8_t* line, uint32_t length, uint8_t* memoryStart)
@@ -631,6 +888,29 @@ namespace OpenKNX
         openknx.logger.logHexWithPrefix(prefix, line, length);
     }
 
+    void Console::printHelpCommand(const ConsoleCommand& command, const char* parent /* = nullptr */)
+    {
+        if (command.flags & ConsoleCommandHidden)
+            return;
+
+        char label[OPENKNX_MAX_LOG_PREFIX_LENGTH + 1] = {};
+        snprintf(label, sizeof(label), "%s%s%s%s%s%s%s",
+                 parent ? parent : "", parent ? " " : "",
+                 command.name,
+                 command.aliases ? ", " : "", command.aliases ? command.aliases : "",
+                 command.args ? " " : "", command.args ? command.args : "");
+
+        if (command.help != nullptr)
+            printHelpLine(label, command.help);
+
+        for (uint8_t i = 0; i < command.childCount; i++)
+        {
+            // aliases and args of parent are not part of the path
+            snprintf(label, sizeof(label), "%s%s%s", parent ? parent : "", parent ? " " : "", command.name);
+            printHelpCommand(command.children[i], label);
+        }
+    }
+
     void Console::printHelpLine(const char* command, const char* message)
     {
         // TODO Beautify
@@ -696,39 +976,34 @@ namespace OpenKNX
 #endif // ARDUINO_ARCH_RP2040
 
 #ifndef ARDUINO_ARCH_SAMD
-    void Console::processPinCommand(const std::string& cmd)
+    bool Console::processPinCommand(ConsoleContext& context)
     {
-        auto _pos = cmd.find(' ');
-        if (_pos != std::string::npos)
+        // dw, dr, aw, ar, dwon, dwoff
+        const char* command = context.command->name;
+        const bool write = command[1] == 'w';
+        const bool digital = command[0] == 'd';
+        const bool fixedValue = strlen(command) > 2;
+
+        if (context.argc < ((write && !fixedValue) ? 2 : 1))
+            return false;
+
+        const pin_size_t pin = atoi(context.argv[0]);
+        if (!write)
         {
-            pin_size_t pin = std::stoi(cmd.substr(_pos + 1));
-            if (cmd.compare(0, 2, "dw") == 0 || cmd.compare(0, 2, "aw") == 0)
-            {
-                auto __pos = cmd.find(' ', _pos + 1);
-                if (__pos != std::string::npos)
-                {
-                    int value = std::stoi(cmd.substr(__pos + 1));
-                    if (cmd.compare(0, 2, "dw") == 0 && value <= HIGH)
-                    {
-                        digitalWrite(pin, value);
-                        openknx.logger.logWithPrefixAndValues("PinCommand", "Write pin %i to %i", pin, value);
-                    }
-                    else if (cmd.compare(0, 2, "aw") == 0 && value <= 4095)
-                    {
-                        analogWrite(pin, value);
-                        openknx.logger.logWithPrefixAndValues("PinCommand", "Write pin %i to %i", pin, value);
-                    }
-                }
-            }
-            else if (cmd.compare(0, 2, "dr") == 0)
-            {
-                openknx.logger.logWithPrefixAndValues("PinCommand", "Read pin %i: %i", pin, digitalRead(pin));
-            }
-            else if (cmd.compare(0, 2, "ar") == 0)
-            {
-                openknx.logger.logWithPrefixAndValues("PinCommand", "Read pin %i: %i", pin, analogRead(pin));
-            }
+            openknx.logger.logWithPrefixAndValues("PinCommand", "Read pin %i: %i", pin, digital ? digitalRead(pin) : analogRead(pin));
+            return true;
         }
+
+        const int value = fixedValue ? (strcmp(command, "dwon") == 0 ? HIGH : LOW) : atoi(context.argv[1]);
+        if (digital && value <= HIGH)
+            digitalWrite(pin, value);
+        else if (!digital && value <= 4095)
+            analogWrite(pin, value);
+        else
+            return false;
+
+        openknx.logger.logWithPrefixAndValues("PinCommand", "Write pin %i to %i", pin, value);
+        return true;
     }
 #endif
 } // namespace OpenKNX
\ No newline at end of file
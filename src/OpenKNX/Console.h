@@ -1,6 +1,10 @@
 #pragma once
+#include "OpenKNX/ConsoleCommand.h"
+#include "OpenKNX/ConsoleScript.h"
+#include "OpenKNX/DiagnoseProtocol.h"
 #include "OpenKNX/defines.h"
 #include "knx.h"
+#include <functional>
 #include <string>
 #ifdef WATCHDOG
     #include <Adafruit_SleepyDog.h>
@@ -19,9 +23,40 @@ extern "C"
     #define CONSOLE_INPUT_SIZE 100
 #endif
 
+// max length of a command line, which is looked up in the command table (the framed diagnose request can be longer than the input)
+#if defined(BASE_KoDiagnose) && OPENKNX_DIAGNOSE_REQUEST_SIZE > CONSOLE_INPUT_SIZE
+    #define CONSOLE_COMMAND_SIZE OPENKNX_DIAGNOSE_REQUEST_SIZE
+#else
+    #define CONSOLE_COMMAND_SIZE CONSOLE_INPUT_SIZE
+#endif
+
+// number of entered commands kept for recall with arrow up/down
+#ifndef OPENKNX_CONSOLE_HISTORY
+    #ifdef ARDUINO_ARCH_SAMD
+        #define OPENKNX_CONSOLE_HISTORY 2
+    #else
+        #define OPENKNX_CONSOLE_HISTORY 8
+    #endif
+#endif
+
+// max time in us per loop to process received chars
+#ifndef OPENKNX_CONSOLE_INPUT_BUDGET
+    #define OPENKNX_CONSOLE_INPUT_BUDGET 500
+#endif
+
 namespace OpenKNX
 {
 
+    /*
+     * A stepwise console output. It is called with an increasing step (starting at 0) and
+     * returns true as long as more steps follow. Each step should output only a few lines.
+     */
+    typedef std::function<bool(uint16_t step)> ConsoleJob;
+
+#ifdef ARDUINO_ARCH_RP2040
+    struct FilesystemListing;
+#endif
+
     enum class EraseMode
     {
         All,
@@ -32,9 +67,41 @@ namespace OpenKNX
 
     class Console
     {
+        friend class ConsoleBuiltins;
+
       private:
+        const ConsoleCommand* _commands[OPENKNX_CONSOLE_MAX_COMMANDS];
+        uint8_t _commandCount = 0;
+
+        uint8_t tokenize(char* line, const char** tokens);
+        bool matchCommand(const ConsoleCommand& command, const char* word);
+        const ConsoleCommand* findCommand(const ConsoleCommand* commands, uint8_t count, const char* word);
+        const ConsoleCommand* findRootCommand(const char* word);
+        void printHelpCommand(const ConsoleCommand& command, const char* parent = nullptr);
+
+        ConsoleJob _job = nullptr;
+        uint16_t _jobStep = 0;
+        uint16_t _jobNumber = 0;
+        // capture sink at the start of the job (e.g. a framed diagnose command) - used for all steps
+        Print* _jobCapture = nullptr;
+
+        void processJob();
+        void runSteps(ConsoleJob job);
+
         uint8_t _consoleCharRepeats = 0;
         uint8_t _consoleCharLast = 0x0;
+        uint8_t _promptLength = 0;
+        uint8_t _escapeState = 0;
+#if OPENKNX_CONSOLE_HISTORY > 0
+        char _history[OPENKNX_CONSOLE_HISTORY][CONSOLE_INPUT_SIZE + 1] = {};
+        uint8_t _historyCount = 0;
+        uint8_t _historyHead = 0;
+        uint8_t _historyPosition = 0; // 0 = current input, 1 = last command, ...
+        void addHistory();
+        void recallHistory(bool older);
+#endif
+        bool processInputChar(uint8_t current);
+        void setPrompt(const char* text);
         bool _diagnoseKoOutput = false;
 
         void sleep();
@@ -42,14 +109,20 @@ namespace OpenKNX
         void showWatchdogResets(bool diagnoseKo = false);
 #ifdef ARDUINO_ARCH_RP2040
         void resetToBootloader();
+        ConsoleScript _script;
+    #ifdef OPENKNX_CONSOLE_AUTORUN
+        bool _autorunChecked = false;
+    #endif
         void showFilesystem();
-        void showFilesystemDirectory(std::string path);
+        void startFilesystemJob();
+        bool showFilesystemStep(uint16_t step, FilesystemListing& listing);
 #endif
         void erase(EraseMode mode = EraseMode::All);
 #ifndef ARDUINO_ARCH_SAMD
-        void processPinCommand(const std::string& cmd);
+        bool processPinCommand(ConsoleContext& context);
 #endif
 #ifdef BASE_KoDiagnose
+        DiagnoseProtocol _diagnoseProtocol;
         void writeDiagnoseKo(const char* message, va_list& values);
 #endif
 
@@ -59,15 +132,50 @@ namespace OpenKNX
 
         void printHelpLine(const char* command, const char* message);
         bool processCommand(std::string cmd, bool diagnoseKo = false);
+        bool processCommand(const char* cmd, bool diagnoseKo = false);
+
+        /*
+         * Register a command (with subcommands) of a module. It is shown in help and dispatched before the
+         * processCommand of the modules is asked. The command must be static, because only the pointer is stored.
+         * @return false if too many commands are registered
+         */
+        bool registerCommand(const ConsoleCommand& command);
+
+        /*
+         * Start a long output, which is processed in the following loops within the free loop time,
+         * so the knx stack and the modules are not blocked. Input is ignored until the job is finished.
+         * A running job is finished synchronously first. The output of all steps goes to the capture sink
+         * active at the start.
+         */
+        void startJob(ConsoleJob job);
+        bool jobActive();
+        /*
+         * Number of the last started job, to recognize the end of an own job
+         */
+        uint16_t jobNumber();
+        /*
+         * Capture sink of the running job (nullptr = no job or no capture)
+         */
+        Print* jobCapture();
+        /*
+         * Process the remaining steps of a running job synchronously
+         */
+        void finishJob();
+
         void showMemory(bool diagnoseKo = false);
         void processSerialInput();
         void showInformations();
+        bool showInformationsStep(uint16_t step);
         void showVersions();
+        bool showVersionsStep(uint16_t step);
         void showUptime(bool diagnoseKo = false);
         void showMemoryContent(uint8_t* start, uint32_t size);
+        void startMemoryContentJob(uint8_t* start, uint32_t size);
+        bool showMemoryContentStep(uint16_t step, uint8_t* start, uint32_t size, uint8_t*& position);
         void showMemoryLine(uint8_t* line, uint32_t length, uint8_t* memoryStart);
 
         void showHelp();
+        bool showHelpStep(uint16_t step);
 
 #ifdef BASE_KoDiagnose
         void processDiagnoseKo(GroupObject& ko);
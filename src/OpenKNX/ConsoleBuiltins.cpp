@@ -0,0 +1,489 @@
+#include "OpenKNX/ConsoleBuiltins.h"
+#include "OpenKNX/Facade.h"
+
+#ifdef ARDUINO_ARCH_RP2040
+    #include "LittleFS.h"
+#endif
+
+namespace OpenKNX
+{
+    bool ConsoleBuiltins::help(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.console.showHelpStep(step); });
+        return true;
+    }
+
+    bool ConsoleBuiltins::info(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.console.showInformationsStep(step); });
+        return true;
+    }
+
+    bool ConsoleBuiltins::versions(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.console.showVersionsStep(step); });
+        return true;
+    }
+
+    bool ConsoleBuiltins::memory(ConsoleContext &context)
+    {
+        if (context.argc == 0)
+        {
+            openknx.console.showMemory(context.diagnoseKo);
+            return true;
+        }
+
+        char *end = nullptr;
+        const uint32_t addr = strtoul(context.argv[0], &end, 16);
+        if (end == context.argv[0] || *end != '\0')
+            return false;
+
+        openknx.console.startMemoryContentJob((uint8_t *)addr, 0x40);
+        return true;
+    }
+
+#ifdef OPENKNX_HEAP_TRACKER
+    bool ConsoleBuiltins::memoryModules(ConsoleContext &context)
+    {
+        Stat::HeapTracker::showStatus();
+        return true;
+    }
+#endif
+
+    bool ConsoleBuiltins::prog(ConsoleContext &context)
+    {
+        knx.toggleProgMode();
+        return true;
+    }
+
+    bool ConsoleBuiltins::uptime(ConsoleContext &context)
+    {
+        openknx.console.showUptime(context.diagnoseKo);
+        return true;
+    }
+
+    bool ConsoleBuiltins::sleep(ConsoleContext &context)
+    {
+        openknx.console.sleep();
+        return true;
+    }
+
+    bool ConsoleBuiltins::restart(ConsoleContext &context)
+    {
+        delay(20);
+        openknx.restart();
+        return true;
+    }
+
+    bool ConsoleBuiltins::fatal(ConsoleContext &context)
+    {
+        openknx.hardware.fatalError(5, "Test with 5x blinking");
+        return true;
+    }
+
+    bool ConsoleBuiltins::powerloss(ConsoleContext &context)
+    {
+        openknx.common.triggerSavePin();
+        return true;
+    }
+
+    bool ConsoleBuiltins::save(ConsoleContext &context)
+    {
+        openknx.flash.save();
+        return true;
+    }
+
+    bool ConsoleBuiltins::flashKnx(ConsoleContext &context)
+    {
+        openknx.console.startMemoryContentJob(openknx.knxFlash.flashAddress(), openknx.knxFlash.size());
+        return true;
+    }
+
+    bool ConsoleBuiltins::flashOpenKnx(ConsoleContext &context)
+    {
+        openknx.console.startMemoryContentJob(openknx.openknxFlash.flashAddress(), openknx.openknxFlash.size());
+        return true;
+    }
+
+#ifndef ARDUINO_ARCH_SAMD
+    bool ConsoleBuiltins::pin(ConsoleContext &context)
+    {
+        return openknx.console.processPinCommand(context);
+    }
+#endif
+
+#ifdef OPENKNX_RUNTIME_STAT
+    bool ConsoleBuiltins::runtime(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.common.showRuntimeStatStep(step); });
+        return true;
+    }
+
+    bool ConsoleBuiltins::runtimeHist(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.common.showRuntimeStatStep(step, false, true); });
+        return true;
+    }
+
+    bool ConsoleBuiltins::runtimeFull(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.common.showRuntimeStatStep(step, true, true); });
+        return true;
+    }
+#endif
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+    bool ConsoleBuiltins::koRouting(ConsoleContext &context)
+    {
+        openknx.common.showInputKoRouting();
+        return true;
+    }
+#endif
+
+#ifdef OPENKNX_KO_BATCH
+    bool ConsoleBuiltins::koBatch(ConsoleContext &context)
+    {
+        openknx.common.showInputKoBatch();
+        return true;
+    }
+#endif
+
+#ifdef OPENKNX_KO_QUEUE
+    bool ConsoleBuiltins::koQueue(ConsoleContext &context)
+    {
+        openknx.common.showInputKoQueue();
+        return true;
+    }
+#endif
+
+    bool ConsoleBuiltins::tasks(ConsoleContext &context)
+    {
+        openknx.tasks.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::timers(ConsoleContext &context)
+    {
+        openknx.timers.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::buttons(ConsoleContext &context)
+    {
+        openknx.buttons.showStatus();
+        return true;
+    }
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+    bool ConsoleBuiltins::transmit(ConsoleContext &context)
+    {
+        openknx.transmit.showStatus();
+        return true;
+    }
+#endif
+
+#ifdef OPENKNX_BOOTPROFILE
+    bool ConsoleBuiltins::boot(ConsoleContext &context)
+    {
+        openknx.bootProfile.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::bootLast(ConsoleContext &context)
+    {
+        openknx.bootProfile.showPrevious();
+        return true;
+    }
+#endif
+
+#ifdef OPENKNX_EVENTTRACE
+    bool ConsoleBuiltins::trace(ConsoleContext &context)
+    {
+        openknx.eventTrace.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::traceStart(ConsoleContext &context)
+    {
+        openknx.eventTrace.start();
+        openknx.eventTrace.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::traceStop(ConsoleContext &context)
+    {
+        openknx.eventTrace.stop();
+        openknx.eventTrace.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::traceClear(ConsoleContext &context)
+    {
+        openknx.eventTrace.clear();
+        openknx.eventTrace.showStatus();
+        return true;
+    }
+
+    bool ConsoleBuiltins::traceDump(ConsoleContext &context)
+    {
+        openknx.console.startJob([](uint16_t step) -> bool { return openknx.eventTrace.dumpStep(step); });
+        return true;
+    }
+#endif
+
+#ifdef OPENKNX_WATCHDOG
+    bool ConsoleBuiltins::watchdog(ConsoleContext &context)
+    {
+        openknx.console.showWatchdogResets(context.diagnoseKo);
+        return true;
+    }
+#endif
+
+#ifdef ARDUINO_ARCH_RP2040
+    bool ConsoleBuiltins::files(ConsoleContext &context)
+    {
+        openknx.console.startFilesystemJob();
+        return true;
+    }
+
+    bool ConsoleBuiltins::fileDummy(ConsoleContext &context)
+    {
+        File file = LittleFS.open("dummy.dummy", "a");
+        file.seek(rp2040.hwrand32());
+        file.write("DUMMY");
+        file.close();
+        openknx.console.startFilesystemJob();
+        return true;
+    }
+
+    bool ConsoleBuiltins::run(ConsoleContext &context)
+    {
+        if (context.argc == 0)
+        {
+            openknx.console._script.showStatus();
+            return true;
+        }
+
+        openknx.console._script.start(context.argv[0], context.argc > 1 ? context.argv[1] : nullptr);
+        return true;
+    }
+
+    bool ConsoleBuiltins::runStop(ConsoleContext &context)
+    {
+        openknx.console._script.stop();
+        return true;
+    }
+
+    bool ConsoleBuiltins::bootloader(ConsoleContext &context)
+    {
+        openknx.console.resetToBootloader();
+        return true;
+    }
+
+    bool ConsoleBuiltins::eraseFiles(ConsoleContext &context)
+    {
+        openknx.console.erase(EraseMode::Filesystem);
+        return true;
+    }
+#endif
+
+    bool ConsoleBuiltins::eraseKnx(ConsoleContext &context)
+    {
+        openknx.console.erase(EraseMode::KnxFlash);
+        return true;
+    }
+
+    bool ConsoleBuiltins::eraseOpenKnx(ConsoleContext &context)
+    {
+        openknx.console.erase(EraseMode::OpenKnxFlash);
+        return true;
+    }
+
+    bool ConsoleBuiltins::eraseAll(ConsoleContext &context)
+    {
+        openknx.console.erase(EraseMode::All);
+        return true;
+    }
+
+#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
+    static TpUartDataLinkLayer *dataLinkLayer()
+    {
+    #if MASK_VERSION == 0x07B0
+        return knx.bau().getDataLinkLayer();
+    #elif MASK_VERSION == 0x091A
+        return knx.bau().getSecondaryDataLinkLayer();
+    #endif
+    }
+
+    bool ConsoleBuiltins::bcu(ConsoleContext &context)
+    {
+        TpUartDataLinkLayer *dll = dataLinkLayer();
+        logInfo("BCU<Status>", "%s", dll->isConnected() ? "Connected" : "Disconnected");
+        logInfo("BCU<Received>", "Processed: %i - Ignored: %i - Invalid: %i - Unknown: %i",
+                dll->getRxProcessdFrameCounter(), dll->getRxIgnoredFrameCounter(), dll->getRxInvalidFrameCounter(), dll->getRxUnknownControlCounter());
+        logInfo("BCU<Transmitted>", "Processed: %i/%i", dll->getTxProcessedFrameCounter(), dll->getTxFrameCounter());
+        return true;
+    }
+
+    bool ConsoleBuiltins::bcuMonitor(ConsoleContext &context)
+    {
+        logInfo("KNX<BCU>", "Start BCU monitoring");
+        dataLinkLayer()->monitor();
+        return true;
+    }
+
+    bool ConsoleBuiltins::bcuReset(ConsoleContext &context)
+    {
+        logInfo("KNX<BCU>", "Reset BCU");
+        dataLinkLayer()->reset();
+        return true;
+    }
+
+    #ifdef NCN5120
+    bool ConsoleBuiltins::bcuPowerOff(ConsoleContext &context)
+    {
+        logInfo("KNX<BCU>", "Switch off VCC2");
+        dataLinkLayer()->powerControl(false);
+        return true;
+    }
+
+    bool ConsoleBuiltins::bcuPowerOn(ConsoleContext &context)
+    {
+        logInfo("KNX<BCU>", "Switch on VCC2");
+        dataLinkLayer()->powerControl(true);
+        return true;
+    }
+    #endif
+#endif
+
+#ifdef OPENKNX_HEAP_TRACKER
+    static const ConsoleCommand memoryCommands[] = {
+        {"modules", nullptr, nullptr, "Show heap usage per module and framework component", ConsoleCommandDefault, &ConsoleBuiltins::memoryModules},
+    };
+#endif
+
+    static const ConsoleCommand flashCommands[] = {
+        {"knx", nullptr, nullptr, "Show knx flash content", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::flashKnx},
+        {"openknx", nullptr, nullptr, "Show openknx flash content", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::flashOpenKnx},
+    };
+
+#ifdef OPENKNX_RUNTIME_STAT
+    static const ConsoleCommand runtimeCommands[] = {
+        {"hist", nullptr, nullptr, "Show runtime histogram", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::runtimeHist},
+        {"full", nullptr, nullptr, "Show runtime statistics and histogram", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::runtimeFull},
+    };
+#endif
+
+#ifdef OPENKNX_BOOTPROFILE
+    static const ConsoleCommand bootCommands[] = {
+        {"last", nullptr, nullptr, "Show the boot timeline before the last warm restart", ConsoleCommandDefault, &ConsoleBuiltins::bootLast},
+    };
+#endif
+
+#ifdef OPENKNX_EVENTTRACE
+    static const ConsoleCommand traceCommands[] = {
+        {"start", nullptr, nullptr, "Start event recording", ConsoleCommandDefault, &ConsoleBuiltins::traceStart},
+        {"stop", nullptr, nullptr, "Stop event recording", ConsoleCommandDefault, &ConsoleBuiltins::traceStop},
+        {"clear", nullptr, nullptr, "Clear recorded events", ConsoleCommandDefault, &ConsoleBuiltins::traceClear},
+        {"dump", nullptr, nullptr, "Dump recorded events (see eventtrace2chrome.py)", ConsoleCommandDefault, &ConsoleBuiltins::traceDump},
+    };
+#endif
+
+#ifdef ARDUINO_ARCH_RP2040
+    static const ConsoleCommand fileCommands[] = {
+        {"dummy", nullptr, nullptr, "Append dummy data to a file", ConsoleCommandHidden, &ConsoleBuiltins::fileDummy},
+    };
+
+    static const ConsoleCommand runCommands[] = {
+        {"stop", nullptr, nullptr, "Stop the running script (or ctrl-c)", ConsoleCommandDefault, &ConsoleBuiltins::runStop},
+    };
+#endif
+
+    static const ConsoleCommand eraseCommands[] = {
+        {"knx", nullptr, nullptr, "Erase knx parameters", ConsoleCommandDefault, &ConsoleBuiltins::eraseKnx},
+        {"openknx", nullptr, nullptr, "Erase openknx module data", ConsoleCommandDefault, &ConsoleBuiltins::eraseOpenKnx},
+#ifdef ARDUINO_ARCH_RP2040
+        {"files", nullptr, nullptr, "Erase filesystem", ConsoleCommandDefault, &ConsoleBuiltins::eraseFiles},
+#endif
+        {"all", nullptr, nullptr, "Erase all", ConsoleCommandDefault, &ConsoleBuiltins::eraseAll},
+    };
+
+#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
+    static const ConsoleCommand bcuCommands[] = {
+        {"mon", nullptr, nullptr, "Start BCU monitoring", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::bcuMonitor},
+        {"rst", nullptr, nullptr, "Reset BCU", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::bcuReset},
+    #ifdef NCN5120
+        {"poff", nullptr, nullptr, "Switch off VCC2", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::bcuPowerOff},
+        {"pon", nullptr, nullptr, "Switch on VCC2", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::bcuPowerOn},
+    #endif
+    };
+#endif
+
+    const ConsoleCommand ConsoleBuiltins::commands[] = {
+        {"help", "h", nullptr, "Show this help", ConsoleCommandDefault, &ConsoleBuiltins::help},
+        {"info", "i", nullptr, "Show general information", ConsoleCommandDefault, &ConsoleBuiltins::info},
+        {"uptime", "u", nullptr, "Show uptime", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::uptime},
+        {"versions", "v", nullptr, "Show compiled versions", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::versions},
+#ifdef OPENKNX_HEAP_TRACKER
+        {"memory", "mem, m", "[0xXXXXXXXX]", "Show memory usage or content (64byte) starting at 0xXXXXXXXX", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::memory, CONSOLE_SUBCOMMANDS(memoryCommands)},
+#else
+        {"memory", "mem, m", "[0xXXXXXXXX]", "Show memory usage or content (64byte) starting at 0xXXXXXXXX", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::memory},
+#endif
+        {"flash", nullptr, nullptr, nullptr, ConsoleCommandDiagnoseKo, nullptr, CONSOLE_SUBCOMMANDS(flashCommands)},
+#ifdef ARDUINO_ARCH_RP2040
+        {"files", "fs", nullptr, "Show files on filesystem", ConsoleCommandDefault, &ConsoleBuiltins::files},
+        {"file", nullptr, nullptr, nullptr, ConsoleCommandHidden, nullptr, CONSOLE_SUBCOMMANDS(fileCommands)},
+        {"run", nullptr, "[<file> [<logfile>]]", "Execute the commands of a file (or show the running script)", ConsoleCommandDefault, &ConsoleBuiltins::run, CONSOLE_SUBCOMMANDS(runCommands)},
+#endif
+#ifdef OPENKNX_RUNTIME_STAT
+        {"runtime", nullptr, nullptr, "Show runtime statistics (Short statistic)", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::runtime, CONSOLE_SUBCOMMANDS(runtimeCommands)},
+#endif
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        {"korouting", nullptr, nullptr, "Show KO ranges of modules and dispatch statistic", ConsoleCommandDefault, &ConsoleBuiltins::koRouting},
+#endif
+#ifdef OPENKNX_KO_BATCH
+        {"kobatch", nullptr, nullptr, "Show statistic of batched KO delivery", ConsoleCommandDefault, &ConsoleBuiltins::koBatch},
+#endif
+#ifdef OPENKNX_KO_QUEUE
+        {"koqueue", nullptr, nullptr, "Show queued GroupObject events of modules", ConsoleCommandDefault, &ConsoleBuiltins::koQueue},
+#endif
+        {"tasks", nullptr, nullptr, "Show task queue statistics", ConsoleCommandDefault, &ConsoleBuiltins::tasks},
+        {"timers", nullptr, nullptr, "Show scheduled callbacks of the timer wheel", ConsoleCommandDefault, &ConsoleBuiltins::timers},
+        {"buttons", nullptr, nullptr, "Show inputs and event queue of the gesture detection", ConsoleCommandDefault, &ConsoleBuiltins::buttons},
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        {"transmit", nullptr, nullptr, "Show statistics of the rate limited send queue", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::transmit},
+#endif
+#ifdef OPENKNX_BOOTPROFILE
+        {"boot", nullptr, nullptr, "Show the boot timeline (us since reset)", ConsoleCommandDefault, &ConsoleBuiltins::boot, CONSOLE_SUBCOMMANDS(bootCommands)},
+#endif
+#ifdef OPENKNX_EVENTTRACE
+        {"trace", nullptr, nullptr, "Show event trace status", ConsoleCommandDefault, &ConsoleBuiltins::trace, CONSOLE_SUBCOMMANDS(traceCommands)},
+#endif
+        {"restart", "r", nullptr, "Restart the device", ConsoleCommandDefault, &ConsoleBuiltins::restart},
+        {"prog", "p", nullptr, "Toggle the ProgMode", ConsoleCommandDefault, &ConsoleBuiltins::prog},
+        {"save", "s, w", nullptr, "Save data in Flash", ConsoleCommandDefault, &ConsoleBuiltins::save},
+        {"sleep", nullptr, nullptr, "Sleep for up to 20 seconds", ConsoleCommandDefault, &ConsoleBuiltins::sleep},
+        {"fatal", nullptr, nullptr, "Trigger a FatalError", ConsoleCommandDefault, &ConsoleBuiltins::fatal},
+        {"powerloss", nullptr, nullptr, "Trigger a PowerLoss (SavePin)", ConsoleCommandDefault, &ConsoleBuiltins::powerloss},
+#ifdef OPENKNX_WATCHDOG
+        {"watchdog", nullptr, nullptr, "Show restart count by watchdog", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::watchdog},
+#endif
+        {"erase", nullptr, nullptr, nullptr, ConsoleCommandDefault, nullptr, CONSOLE_SUBCOMMANDS(eraseCommands)},
+#ifdef ARDUINO_ARCH_RP2040
+        {"bootloader", nullptr, nullptr, "Reset into Bootloader Mode", ConsoleCommandDefault, &ConsoleBuiltins::bootloader},
+#endif
+#ifndef ARDUINO_ARCH_SAMD
+        {"dwon", nullptr, "<pin>", "Write digital pin to HIGH", ConsoleCommandDefault, &ConsoleBuiltins::pin},
+        {"dwoff", nullptr, "<pin>", "Write digital pin to LOW", ConsoleCommandDefault, &ConsoleBuiltins::pin},
+        {"dw", nullptr, "<pin> 0-1", "Write digital pin", ConsoleCommandDefault, &ConsoleBuiltins::pin},
+        {"dr", nullptr, "<pin>", "Read digital pin", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::pin},
+        {"aw", nullptr, "<pin> 0-4095", "Write analog pin", ConsoleCommandDefault, &ConsoleBuiltins::pin},
+        {"ar", nullptr, "<pin>", "Read analog pin", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::pin},
+#endif
+#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
+        {"bcu", nullptr, nullptr, "Show BCU status", ConsoleCommandDiagnoseKo, &ConsoleBuiltins::bcu, CONSOLE_SUBCOMMANDS(bcuCommands)},
+#endif
+    };
+
+    const uint8_t ConsoleBuiltins::count = sizeof(ConsoleBuiltins::commands) / sizeof(ConsoleBuiltins::commands[0]);
+} // namespace OpenKNX
@@ -0,0 +1,89 @@
+#pragma once
+#include "OpenKNX/ConsoleCommand.h"
+
+namespace OpenKNX
+{
+    /*
+     * Command table and handlers of the commands provided by the framework
+     */
+    class ConsoleBuiltins
+    {
+      public:
+        static const ConsoleCommand commands[];
+        static const uint8_t count;
+
+        static bool help(ConsoleContext &context);
+        static bool info(ConsoleContext &context);
+        static bool versions(ConsoleContext &context);
+        static bool memory(ConsoleContext &context);
+#ifdef OPENKNX_HEAP_TRACKER
+        static bool memoryModules(ConsoleContext &context);
+#endif
+        static bool prog(ConsoleContext &context);
+        static bool uptime(ConsoleContext &context);
+        static bool sleep(ConsoleContext &context);
+        static bool restart(ConsoleContext &context);
+        static bool fatal(ConsoleContext &context);
+        static bool powerloss(ConsoleContext &context);
+        static bool save(ConsoleContext &context);
+        static bool flashKnx(ConsoleContext &context);
+        static bool flashOpenKnx(ConsoleContext &context);
+#ifndef ARDUINO_ARCH_SAMD
+        static bool pin(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_RUNTIME_STAT
+        static bool runtime(ConsoleContext &context);
+        static bool runtimeHist(ConsoleContext &context);
+        static bool runtimeFull(ConsoleContext &context);
+#endif
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        static bool koRouting(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_KO_BATCH
+        static bool koBatch(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_KO_QUEUE
+        static bool koQueue(ConsoleContext &context);
+#endif
+        static bool tasks(ConsoleContext &context);
+        static bool timers(ConsoleContext &context);
+        static bool buttons(ConsoleContext &context);
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        static bool transmit(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_EVENTTRACE
+        static bool trace(ConsoleContext &context);
+        static bool traceStart(ConsoleContext &context);
+        static bool traceStop(ConsoleContext &context);
+        static bool traceClear(ConsoleContext &context);
+        static bool traceDump(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_BOOTPROFILE
+        static bool boot(ConsoleContext &context);
+        static bool bootLast(ConsoleContext &context);
+#endif
+#ifdef OPENKNX_WATCHDOG
+        static bool watchdog(ConsoleContext &context);
+#endif
+#ifdef ARDUINO_ARCH_RP2040
+        static bool files(ConsoleContext &context);
+        static bool fileDummy(ConsoleContext &context);
+        static bool run(ConsoleContext &context);
+        static bool runStop(ConsoleContext &context);
+        static bool bootloader(ConsoleContext &context);
+        static bool eraseFiles(ConsoleContext &context);
+#endif
+        static bool eraseKnx(ConsoleContext &context);
+        static bool eraseOpenKnx(ConsoleContext &context);
+        static bool eraseAll(ConsoleContext &context);
+#if MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A
+        static bool bcu(ConsoleContext &context);
+        static bool bcuMonitor(ConsoleContext &context);
+        static bool bcuReset(ConsoleContext &context);
+    #ifdef NCN5120
+        static bool bcuPowerOff(ConsoleContext &context);
+        static bool bcuPowerOn(ConsoleContext &context);
+    #endif
+#endif
+    };
+} // namespace OpenKNX
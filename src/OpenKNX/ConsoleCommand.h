@@ -0,0 +1,69 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+
+// max number of words of a command line (command + arguments)
+#ifndef OPENKNX_CONSOLE_MAX_TOKENS
+    #define OPENKNX_CONSOLE_MAX_TOKENS 8
+#endif
+
+// max number of commands registered by modules (root level)
+#ifndef OPENKNX_CONSOLE_MAX_COMMANDS
+    #define OPENKNX_CONSOLE_MAX_COMMANDS 16
+#endif
+
+#define CONSOLE_SUBCOMMANDS(X) X, (sizeof(X) / sizeof(X[0]))
+
+namespace OpenKNX
+{
+    struct ConsoleCommand;
+
+    enum ConsoleCommandFlags : uint8_t
+    {
+        ConsoleCommandDefault = 0x00,
+        ConsoleCommandDiagnoseKo = 0x01, // can be invoked by diagnoseKo
+        ConsoleCommandHidden = 0x02,     // not shown in help
+    };
+
+    /*
+     * Parsed command line passed to the handler of a command.
+     * The arguments are the words after the command (zero terminated, no copies of the input).
+     */
+    struct ConsoleContext
+    {
+        const ConsoleCommand *command;
+        bool diagnoseKo;
+        uint8_t argc;
+        const char **argv;
+    };
+
+    /*
+     * @return false if the command is not handled (e.g. invalid arguments), then the modules will be asked (processCommand)
+     */
+    typedef bool (*ConsoleHandler)(ConsoleContext &context);
+
+    /*
+     * One word of a command. Subcommands are stored as children, so the command table is a tree of words.
+     * For example "trace" with the children "start", "stop". Each level is searched linearly (the tables are short).
+     *
+     * The tables should be static const, so they are placed in flash:
+     *
+     *   static const OpenKNX::ConsoleCommand myChildren[] = {
+     *       {"start", nullptr, nullptr, "Start my function", OpenKNX::ConsoleCommandDefault, &MyModule::cmdStart},
+     *   };
+     *   static const OpenKNX::ConsoleCommand myCommand = {"my", nullptr, nullptr, "Show my status", OpenKNX::ConsoleCommandDiagnoseKo, &MyModule::cmdStatus, CONSOLE_SUBCOMMANDS(myChildren)};
+     *   openknx.console.registerCommand(myCommand);
+     */
+    struct ConsoleCommand
+    {
+        const char *name;    // single word
+        const char *aliases; // comma separated list of alternative words (or nullptr)
+        const char *args;    // description of arguments for help (or nullptr)
+        const char *help;    // description for help (or nullptr)
+        uint8_t flags;       // ConsoleCommandFlags
+        ConsoleHandler handler;
+        const ConsoleCommand *children;
+        uint8_t childCount;
+        void *data; // custom data for the handler (context.command->data)
+    };
+} // namespace OpenKNX
@@ -0,0 +1,125 @@
+#include "OpenKNX/ConsoleScript.h"
+#include "OpenKNX/Facade.h"
+
+#ifdef ARDUINO_ARCH_RP2040
+namespace OpenKNX
+{
+    std::string ConsoleScript::logPrefix()
+    {
+        return "Script";
+    }
+
+    bool ConsoleScript::start(const char *path, const char *output /* = nullptr */)
+    {
+        stop();
+
+        _file = LittleFS.open(path, "r");
+        if (!_file)
+        {
+            logErrorP("Unable to open %s", path);
+            return false;
+        }
+
+        if (output != nullptr)
+        {
+            _output = LittleFS.open(output, "w");
+            if (!_output)
+            {
+                logErrorP("Unable to create %s", output);
+                _file.close();
+                return false;
+            }
+        }
+
+        logInfoP("Run %s%s%s", path, output ? " > " : "", output ? output : "");
+        _path = path;
+        _line = 0;
+        _active = true;
+
+        if (_output)
+            _previousCapture = openknx.logger.capture(&_output);
+
+        return true;
+    }
+
+    void ConsoleScript::stop()
+    {
+        if (!_active)
+            return;
+
+        _active = false;
+        if (_output)
+        {
+            // a job started by the script still writes into the file - complete its output before closing it
+            if (openknx.console.jobCapture() == &_output)
+                openknx.console.finishJob();
+
+            openknx.logger.capture(_previousCapture);
+            _previousCapture = nullptr;
+            _output.close();
+        }
+        _file.close();
+        logInfoP("Finished %s (%u lines)", _path.c_str(), _line);
+    }
+
+    bool ConsoleScript::active()
+    {
+        return _active;
+    }
+
+    /*
+     * Read the next line without the line break. Longer lines are truncated.
+     * @return false at the end of the file
+     */
+    bool ConsoleScript::readLine(char *buffer, uint8_t size)
+    {
+        uint8_t length = 0;
+        int current = _file.read();
+        if (current < 0)
+            return false;
+
+        while (current >= 0 && current != '\n')
+        {
+            if (current != '\r' && length < size - 1)
+                buffer[length++] = current;
+
+            current = _file.read();
+        }
+        buffer[length] = '\0';
+        _line++;
+        return true;
+    }
+
+    void ConsoleScript::loop()
+    {
+        if (!_active)
+            return;
+
+        char line[CONSOLE_INPUT_SIZE + 1] = {};
+        do
+        {
+            if (!readLine(line, sizeof(line)))
+            {
+                stop();
+                return;
+            }
+        }
+        // skip empty lines and comments
+        while (line[0] == '\0' || line[0] == '#');
+
+        logInfoP("%u: %s", _line, line);
+        logIndentUp();
+        if (!openknx.console.processCommand(line))
+            logErrorP("%s: command not found", line);
+        logIndentDown();
+    }
+
+    void ConsoleScript::showStatus()
+    {
+        if (_active)
+            logInfoP("Running %s (line %u)", _path.c_str(), _line);
+        else
+            logInfoP("No script running");
+    }
+} // namespace OpenKNX
+#endif
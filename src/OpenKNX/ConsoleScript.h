@@ -0,0 +1,56 @@
+#pragma once
+#ifdef ARDUINO_ARCH_RP2040
+    #include "LittleFS.h"
+    #include "OpenKNX/defines.h"
+    #include <string>
+
+// Executed after the startup delay, if the file exists (e.g. "/autorun.txt"). Undefined = no autorun.
+// #define OPENKNX_CONSOLE_AUTORUN "/autorun.txt"
+
+    #ifndef OPENKNX_CONSOLE_AUTORUN_LOG
+        #define OPENKNX_CONSOLE_AUTORUN_LOG "/autorun.log"
+    #endif
+
+namespace OpenKNX
+{
+    /*
+     * Executes console commands from a file on LittleFS (command "run <file> [<logfile>]").
+     *
+     * The file is read line by line, one command per loop, so the loop is not blocked.
+     * The next line is executed after the output of the previous command is finished.
+     * Empty lines and lines starting with '#' are skipped.
+     * Optionally the output is written to a log file while the script is running.
+     */
+    class ConsoleScript
+    {
+      private:
+        File _file;
+        File _output;
+        // restored at the end of the script
+        Print *_previousCapture = nullptr;
+        std::string _path;
+        bool _active = false;
+        uint16_t _line = 0;
+
+        bool readLine(char *buffer, uint8_t size);
+
+      public:
+        std::string logPrefix();
+
+        /*
+         * Start a script. A running script is stopped.
+         * @param output log file (overwritten) or nullptr
+         * @return false if the file could not be opened
+         */
+        bool start(const char *path, const char *output = nullptr);
+        void stop();
+        bool active();
+
+        /*
+         * Executes the next command of the script
+         */
+        void loop();
+        void showStatus();
+    };
+} // namespace OpenKNX
+#endif
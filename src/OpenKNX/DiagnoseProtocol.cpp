@@ -0,0 +1,229 @@
+#include "OpenKNX/DiagnoseProtocol.h"
+#include "OpenKNX/Facade.h"
+
+#ifdef BASE_KoDiagnose
+
+    // the sequence number is 8 bit
+    #define OPENKNX_DIAGNOSE_RESPONSE_LIMIT MIN(OPENKNX_DIAGNOSE_RESPONSE_SIZE, 256 * OPENKNX_DIAGNOSE_PAYLOAD_SIZE)
+
+namespace OpenKNX
+{
+    std::string DiagnoseProtocol::logPrefix()
+    {
+        return "DiagnoseKO";
+    }
+
+    bool DiagnoseProtocol::isFrame(const uint8_t *data)
+    {
+        return data[0] >= DiagnoseFrameRequest && data[0] <= DiagnoseFrameResponseTruncated;
+    }
+
+    bool DiagnoseProtocol::capturing()
+    {
+        return _capturing;
+    }
+
+    void DiagnoseProtocol::processFrame(const uint8_t *frame)
+    {
+        switch (frame[0])
+        {
+            case DiagnoseFrameRequest:
+            case DiagnoseFrameRequestEnd:
+                receiveRequest(frame);
+                break;
+
+            case DiagnoseFrameResend:
+                if (frame[1] != _responseSession || frame[2] >= _responseFrames)
+                {
+                    sendFrame(DiagnoseFrameAbort, frame[1], frame[2], nullptr, 0);
+                    break;
+                }
+
+                // go back and send all following frames again
+                _responseSequence = frame[2];
+                _responseActive = true;
+                break;
+
+            case DiagnoseFrameAbort:
+                if (frame[1] == _responseSession)
+                    _responseActive = false;
+                if (frame[1] == _requestSession)
+                    _requestLength = 0;
+                if (frame[1] == _commandSession)
+                    _commandPending = false;
+                break;
+
+            default:
+                // own response frames
+                break;
+        }
+    }
+
+    void DiagnoseProtocol::receiveRequest(const uint8_t *frame)
+    {
+        const uint8_t session = frame[1];
+        const uint8_t sequence = frame[2];
+
+        // first fragment starts a new request and cancels a running response
+        if (sequence == 0)
+        {
+            _requestSession = session;
+            _requestSequence = 0;
+            _requestLength = 0;
+            _requestStart = millis();
+            _responseActive = false;
+        }
+        else if (session != _requestSession || sequence != _requestSequence || delayCheck(_requestStart, OPENKNX_DIAGNOSE_TIMEOUT))
+        {
+            logDebugP("Invalid fragment %u of session %u", sequence, session);
+            _requestLength = 0;
+            sendFrame(DiagnoseFrameAbort, session, sequence, nullptr, 0);
+            return;
+        }
+
+        for (uint8_t i = OPENKNX_DIAGNOSE_HEADER_SIZE; i < OPENKNX_DIAGNOSE_FRAME_SIZE && frame[i] != '\0'; i++)
+        {
+            if (_requestLength >= OPENKNX_DIAGNOSE_REQUEST_SIZE)
+            {
+                logErrorP("Command too long (max %u)", OPENKNX_DIAGNOSE_REQUEST_SIZE);
+                _requestLength = 0;
+                sendFrame(DiagnoseFrameAbort, session, sequence, nullptr, 0);
+                return;
+            }
+            _request[_requestLength++] = frame[i];
+        }
+        _requestSequence++;
+
+        if (frame[0] == DiagnoseFrameRequestEnd)
+        {
+            // executed by the console loop
+            memcpy(_command, _request, _requestLength);
+            _command[_requestLength] = '\0';
+            _commandSession = _requestSession;
+            _commandPending = true;
+            _requestLength = 0;
+        }
+    }
+
+    void DiagnoseProtocol::execute()
+    {
+        _commandPending = false;
+        logInfoP("framed command \"%s\" received (session %u)", _command, _commandSession);
+
+        _responseLength = 0;
+        _responseTruncated = false;
+        _escape = false;
+        _capturing = true;
+        const uint16_t job = openknx.console.jobNumber();
+        Print *previousCapture = openknx.logger.capture(this);
+        logIndentUp();
+
+        if (!openknx.console.processCommand(_command, true))
+            openknx.logger.logWithPrefix("DiagnoseKO", "command not found");
+
+        logIndentDown();
+        openknx.logger.capture(previousCapture);
+
+        // a long output is processed stepwise by the console - the answer needs all of it
+        if (openknx.console.jobActive() && openknx.console.jobNumber() != job)
+        {
+            _executing = true;
+            _job = openknx.console.jobNumber();
+            return;
+        }
+
+        complete();
+    }
+
+    void DiagnoseProtocol::complete()
+    {
+        _executing = false;
+        _capturing = false;
+
+        _responseSession = _commandSession;
+        _responseFrames = MAX(1, (_responseLength + OPENKNX_DIAGNOSE_PAYLOAD_SIZE - 1) / OPENKNX_DIAGNOSE_PAYLOAD_SIZE);
+        _responseSequence = 0;
+        _responseActive = true;
+        logDebugP("Answer %u bytes in %u frames%s", _responseLength, _responseFrames, _responseTruncated ? " (truncated)" : "");
+    }
+
+    size_t DiagnoseProtocol::write(uint8_t byte)
+    {
+        // skip color codes
+        if (byte == 0x1B)
+        {
+            _escape = true;
+            return 1;
+        }
+        if (_escape)
+        {
+            if (isalpha(byte))
+                _escape = false;
+            return 1;
+        }
+
+        if (byte == '\r')
+            return 1;
+
+        // the client is told by the type of the last frame
+        if (_responseLength >= OPENKNX_DIAGNOSE_RESPONSE_LIMIT)
+        {
+            _responseTruncated = true;
+            return 1;
+        }
+
+        _response[_responseLength++] = byte;
+        return 1;
+    }
+
+    void DiagnoseProtocol::loop()
+    {
+        // the own job was finished (or replaced by another one, which finished it first)
+        if (_executing && !(openknx.console.jobActive() && openknx.console.jobNumber() == _job))
+            complete();
+
+        // never interrupt or finish a job of another caller (e.g. usb)
+        if (_commandPending && !_executing && !openknx.console.jobActive())
+            execute();
+
+        if (!_responseActive || !delayCheck(_lastFrame, OPENKNX_DIAGNOSE_FRAME_INTERVAL))
+            return;
+
+    #if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        // share the bus budget with the other sends of the device
+        if (!openknx.transmit.take())
+            return;
+    #endif
+
+        sendResponseFrame();
+    }
+
+    void DiagnoseProtocol::sendResponseFrame()
+    {
+        const uint16_t offset = _responseSequence * OPENKNX_DIAGNOSE_PAYLOAD_SIZE;
+        const uint8_t length = MIN(OPENKNX_DIAGNOSE_PAYLOAD_SIZE, _responseLength - offset);
+        const bool last = (_responseSequence + 1) >= _responseFrames;
+
+        const uint8_t type = !last ? DiagnoseFrameResponse : (_responseTruncated ? DiagnoseFrameResponseTruncated : DiagnoseFrameResponseEnd);
+        sendFrame(type, _responseSession, _responseSequence, _response + offset, length);
+
+        _responseSequence++;
+        if (last)
+            _responseActive = false;
+    }
+
+    void DiagnoseProtocol::sendFrame(uint8_t type, uint8_t session, uint8_t sequence, const char *payload, uint8_t length)
+    {
+        uint8_t *frame = KoBASE_Diagnose.valueRef();
+        memset(frame, 0, OPENKNX_DIAGNOSE_FRAME_SIZE);
+        frame[0] = type;
+        frame[1] = session;
+        frame[2] = sequence;
+        if (length > 0)
+            memcpy(frame + OPENKNX_DIAGNOSE_HEADER_SIZE, payload, length);
+
+        KoBASE_Diagnose.objectWritten();
+        _lastFrame = millis();
+    }
+} // namespace OpenKNX
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+#ifdef BASE_KoDiagnose
+
+    // max length of a framed command (request)
+    #ifndef OPENKNX_DIAGNOSE_REQUEST_SIZE
+        #define OPENKNX_DIAGNOSE_REQUEST_SIZE 64
+    #endif
+
+    // max length of a framed answer (response). Limited by the 8 bit sequence number to 256 frames.
+    #ifndef OPENKNX_DIAGNOSE_RESPONSE_SIZE
+        #ifdef ARDUINO_ARCH_SAMD
+            #define OPENKNX_DIAGNOSE_RESPONSE_SIZE 256
+        #else
+            #define OPENKNX_DIAGNOSE_RESPONSE_SIZE 2048
+        #endif
+    #endif
+
+    // min time in ms between two response frames to limit the bus load
+    #ifndef OPENKNX_DIAGNOSE_FRAME_INTERVAL
+        #define OPENKNX_DIAGNOSE_FRAME_INTERVAL 100
+    #endif
+
+    // an incomplete request is discarded after this time in ms
+    #ifndef OPENKNX_DIAGNOSE_TIMEOUT
+        #define OPENKNX_DIAGNOSE_TIMEOUT 5000
+    #endif
+
+    #define OPENKNX_DIAGNOSE_FRAME_SIZE 14
+    #define OPENKNX_DIAGNOSE_HEADER_SIZE 3
+    #define OPENKNX_DIAGNOSE_PAYLOAD_SIZE (OPENKNX_DIAGNOSE_FRAME_SIZE - OPENKNX_DIAGNOSE_HEADER_SIZE)
+
+namespace OpenKNX
+{
+    /*
+     * The first byte of a frame. Control characters are used, so a frame can not be mixed up
+     * with a plain text command (DPT16) of the diagnose ko.
+     */
+    enum DiagnoseFrameType : uint8_t
+    {
+        DiagnoseFrameRequest = 0x01,           // fragment of a command, more fragments follow
+        DiagnoseFrameRequestEnd = 0x02,        // last fragment of a command - the command is executed
+        DiagnoseFrameResponse = 0x03,          // fragment of the answer, more fragments follow
+        DiagnoseFrameResponseEnd = 0x04,       // last fragment of the answer
+        DiagnoseFrameResend = 0x05,            // client requests the answer again starting at sequence number
+        DiagnoseFrameAbort = 0x06,             // stop the transmission / invalid request (sent by both sides)
+        DiagnoseFrameResponseTruncated = 0x07, // last fragment of an answer, which exceeded OPENKNX_DIAGNOSE_RESPONSE_SIZE
+    };
+
+    /*
+     * Framed request/response protocol on the diagnose ko for answers longer than 14 bytes.
+     *
+     * Frame: [type] [session] [sequence] [11 bytes payload]
+     *
+     * The client sends the command in one or more request frames (sequence starting at 0) with a session
+     * chosen by the client. The command is executed in the next console loop like a command of the diagnose ko
+     * (a long output stepwise as console job), but the whole console output is captured and sent back in
+     * response frames of the same session. The response frames
+     * are paced by OPENKNX_DIAGNOSE_FRAME_INTERVAL. The payload of the last frame is filled with zeros.
+     * If the answer was cut at the max response size, the last frame is sent as DiagnoseFrameResponseTruncated.
+     * Lost frames can be requested again with a resend frame (go back to sequence).
+     *
+     * See scripts/diagnose/diagnose.py for a client.
+     */
+    class DiagnoseProtocol : public Print
+    {
+      private:
+        char _request[OPENKNX_DIAGNOSE_REQUEST_SIZE + 1] = {};
+        uint8_t _requestLength = 0;
+        uint8_t _requestSession = 0;
+        uint8_t _requestSequence = 0;
+        uint32_t _requestStart = 0;
+
+        // a complete request waits for the console loop, so it does not run inside the knx stack
+        char _command[OPENKNX_DIAGNOSE_REQUEST_SIZE + 1] = {};
+        uint8_t _commandSession = 0;
+        bool _commandPending = false;
+        // the command started a console job - the answer is sent after its end
+        bool _executing = false;
+        uint16_t _job = 0;
+
+        char _response[OPENKNX_DIAGNOSE_RESPONSE_SIZE] = {};
+        uint16_t _responseLength = 0;
+        uint8_t _responseSession = 0;
+        uint16_t _responseFrames = 0;
+        uint16_t _responseSequence = 0;
+        bool _responseActive = false;
+        bool _responseTruncated = false;
+        bool _capturing = false;
+        bool _escape = false;
+        uint32_t _lastFrame = 0;
+
+        void receiveRequest(const uint8_t *frame);
+        void execute();
+        void complete();
+        void sendFrame(uint8_t type, uint8_t session, uint8_t sequence, const char *payload, uint8_t length);
+        void sendResponseFrame();
+
+      public:
+        std::string logPrefix();
+
+        /*
+         * @return true if the data of the ko is a frame of this protocol
+         */
+        static bool isFrame(const uint8_t *data);
+
+        void processFrame(const uint8_t *frame);
+        /*
+         * Called by the console loop: executes a pending command (if no other job is running) and sends the answer
+         */
+        void loop();
+
+        /*
+         * Output is captured while a framed command is executed
+         */
+        bool capturing();
+        size_t write(uint8_t byte) override;
+    };
+} // namespace OpenKNX
+#endif
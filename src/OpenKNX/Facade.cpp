@@ -51,6 +51,11 @@ namespace OpenKNX
         return common.afterStartupDelay();
     }
 
+    bool Facade::startupCompleted()
+    {
+        return common.startupCompleted();
+    }
+
     bool Facade::freeLoopTime()
     {
         return common.freeLoopTime();
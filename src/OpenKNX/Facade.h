@@ -1,5 +1,6 @@
 #pragma once
 #include "Helper.h"
+#include "OpenKNX/Buttons.h"
 #include "OpenKNX/Common.h"
 #include "OpenKNX/Console.h"
 #include "OpenKNX/Flash/Default.h"
@@ -11,9 +12,20 @@
 #ifdef OPENKNX_RUNTIME_STAT
     #include "OpenKNX/Stat/RuntimeStat.h"
 #endif
+#include "OpenKNX/Stat/BootProfile.h"
+#include "OpenKNX/Stat/EventTrace.h"
+#include "OpenKNX/Stat/HeapTracker.h"
+#include "OpenKNX/Queue.h"
+#include "OpenKNX/TaskQueue.h"
 #include "OpenKNX/TimerInterrupt.h"
+#include "OpenKNX/TimerWheel.h"
+#include "OpenKNX/TransmitQueue.h"
 #include "OpenKNX/defines.h"
 
+#ifndef OPENKNX_KO_QUEUE_SIZE
+    #define OPENKNX_KO_QUEUE_SIZE 32
+#endif
+
 namespace OpenKNX
 {
     struct Modules
@@ -27,6 +39,12 @@ namespace OpenKNX
     #ifdef OPENKNX_DUALCORE
         Stat::RuntimeStat runtime1[OPENKNX_MAX_MODULES];
     #endif
+#endif
+#ifdef OPENKNX_KO_QUEUE
+        InputKoDispatch koDispatch[OPENKNX_MAX_MODULES];
+        SpscQueue<GroupObject*, OPENKNX_KO_QUEUE_SIZE> koQueue[OPENKNX_MAX_MODULES];
+        uint16_t koQueueMax[OPENKNX_MAX_MODULES];
+        uint32_t koQueueDropped[OPENKNX_MAX_MODULES];
 #endif
     };
 
@@ -41,7 +59,19 @@ namespace OpenKNX
         TimerInterrupt timerInterrupt;
         Hardware hardware;
         Watchdog watchdog;
+        TaskQueue tasks;
+        TimerWheel timers;
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        TransmitQueue transmit;
+#endif
+#ifdef OPENKNX_EVENTTRACE
+        Stat::EventTrace eventTrace;
+#endif
+#ifdef OPENKNX_BOOTPROFILE
+        Stat::BootProfile bootProfile;
+#endif
 
+        Buttons buttons;
         Button progButton = Button("Prog");
 #ifdef FUNC1_BUTTON_PIN
         Button func1Button = Button("Func1");
@@ -88,6 +118,7 @@ namespace OpenKNX
         Module* getModule(uint8_t id);
         Modules* getModules();
         bool afterStartupDelay();
+        bool startupCompleted();
         bool freeLoopTime();
         bool freeLoopIterate(uint8_t size, uint8_t& position, uint8_t& processed);
         void restart();
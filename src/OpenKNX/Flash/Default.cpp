@@ -21,6 +21,8 @@ namespace OpenKNX
 
         void Default::load()
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerFlash);
+            BOOTPROFILE_BEGIN(Stat::BootFlashLoad);
             const uint32_t start = millis();
             loadedModules = new bool[openknx.modules.count];
             logInfoP("Load data from flash");
@@ -55,17 +57,19 @@ namespace OpenKNX
             {
                 logInfoP("Abort: No valid data found");
                 logIndentDown();
+                BOOTPROFILE_END(Stat::BootFlashLoad);
                 return;
             }
 
             loadModuleData();
             initUnloadedModules();
 
-            // erase next slot
-            eraseSlot(nextSlot());
+            // erase next slot (in the background)
+            eraseNextSlot();
 
             logInfoP("Loading completed (%ims)", millis() - start);
             logIndentDown();
+            BOOTPROFILE_END(Stat::BootFlashLoad);
         }
 
         uint16_t Default::slotOffset(bool slot)
@@ -197,21 +201,69 @@ namespace OpenKNX
             }
         }
 
-        void Default::eraseSlot(bool slot)
+        /**
+         * On RP2040 the next slot has to be erased for fast writing on powerloss.
+         * The erase blocks the interrupts and core1, so it is only scheduled here and done by loop().
+         */
+        void Default::eraseNextSlot()
         {
 #ifdef ARDUINO_ARCH_RP2040
-            // On RP2020 we need to erase next slot for fast writing on powerloss
-    #ifdef OPENKNX_DEBUG
-            const uint32_t start = millis();
-    #endif
-            logDebugP("Erase slot %i", slot);
-            logIndentUp();
-            openknx.openknxFlash.write(slotOffset(slot) - slotSize(), 0xFF, slotSize());
+            logDebugP("Erase slot %i in the background", nextSlot());
+            _nextSlotErased = false;
+            _eraseActive = true;
+            _eraseOffset = 0;
+#endif
+        }
+
+        /**
+         * Called by every loop after setup: one sector in free loop time, but at least one per OPENKNX_FLASH_ERASE_INTERVAL,
+         * so the slot is ready soon after the start even on a busy device
+         */
+        void Default::loop()
+        {
+#ifdef ARDUINO_ARCH_RP2040
+            if (_eraseActive && (openknx.freeLoopTime() || delayCheck(_eraseLast, OPENKNX_FLASH_ERASE_INTERVAL)))
+            {
+                eraseNextSlotStep();
+                _eraseLast = millis();
+            }
+#endif
+        }
+
+#ifdef ARDUINO_ARCH_RP2040
+        /**
+         * Erase one sector of the next slot (already erased sectors are skipped by the driver)
+         */
+        void Default::eraseNextSlotStep()
+        {
+            const uint32_t start = slotOffset(nextSlot()) - slotSize();
+            const uint16_t size = MIN(openknx.openknxFlash.sectorSize(), (uint32_t)(slotSize() - _eraseOffset));
+            openknx.openknxFlash.write(start + _eraseOffset, 0xFF, size);
             openknx.openknxFlash.commit();
+            _eraseOffset += size;
+
+            if (_eraseOffset >= slotSize())
+            {
+                logDebugP("Erase of slot %i completed", nextSlot());
+                _eraseActive = false;
+                _nextSlotErased = true;
+            }
+        }
+
+        void Default::finishEraseNextSlot()
+        {
+            const uint32_t start = millis();
+            logDebugP("Finish erase of slot %i", nextSlot());
+            // the state of the slot is unknown without a load - erase all
+            if (!_eraseActive)
+                eraseNextSlot();
+
+            while (!_nextSlotErased)
+                eraseNextSlotStep();
+
             logDebugP("Erase completed (%ims)", millis() - start);
-            logIndentDown();
-#endif
         }
+#endif
 
         void Default::loadModuleData()
         {
@@ -241,7 +293,9 @@ namespace OpenKNX
                     logInfoP("Restore module %s (%i) with %i bytes", module->name().c_str(), moduleId, moduleSize);
                     logIndentUp();
                     logHexTraceP(currentFlash(), moduleSize);
+                    BOOTPROFILE_BEGIN(Stat::BootModuleReadFlash + moduleId);
                     module->readFlash(currentFlash(), moduleSize);
+                    BOOTPROFILE_END(Stat::BootModuleReadFlash + moduleId);
                     loadedModules[moduleId] = true;
                     logIndentDown();
                 }
@@ -252,6 +306,7 @@ namespace OpenKNX
 
         void Default::save(bool force /* = false */)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerFlash);
             openknx.common.skipLooptimeWarning();
 
             _checksum = 0;
@@ -268,9 +323,15 @@ namespace OpenKNX
 
             _lastWrite = millis();
 
+            EVENTTRACE_BEGIN(Stat::EventTraceFlashSave);
             logBegin();
             logInfoP("Save data to flash%s", force ? " (force)" : "");
             logIndentUp();
+#ifdef ARDUINO_ARCH_RP2040
+            // never write into a slot which is not erased completely
+            if (!_nextSlotErased)
+                finishEraseNextSlot();
+#endif
             logDebugP("Slot %i", nextSlot());
 
             // determine some values
@@ -350,12 +411,13 @@ namespace OpenKNX
             // new active slot
             _activeSlot = !_activeSlot;
 
-            // erase next slot
-            eraseSlot(nextSlot());
+            // erase next slot (in the background)
+            eraseNextSlot();
 #endif
 
             logIndentDown();
             logEnd();
+            EVENTTRACE_END(Stat::EventTraceFlashSave);
         }
 
         uint8_t *Default::currentFlash()
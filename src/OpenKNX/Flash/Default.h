@@ -7,6 +7,11 @@
 
 #define FLASH_DATA_FILLBYTE 0xFF
 
+// RP2040: a sector of the next slot is erased at least in this interval (ms), even without free loop time
+#ifndef OPENKNX_FLASH_ERASE_INTERVAL
+    #define OPENKNX_FLASH_ERASE_INTERVAL 100
+#endif
+
 /*
  * The data-structure is optimized for fast sequential writing, to maximize
  * the chance of writing completely after detection of power loss.
@@ -188,6 +193,12 @@ namespace OpenKNX
              * 8) write INIT
              */
             void save(bool force = false);
+
+            /**
+             * Erase the next slot sector by sector in the background (RP2040).
+             * Called in the free loop time after the startup delay.
+             */
+            void loop();
             void write(uint8_t *buffer, uint16_t size = 1);
             void write(uint8_t value, uint16_t size);
             void writeByte(uint8_t value);
@@ -220,7 +231,16 @@ namespace OpenKNX
             void loadModuleData();
             void initUnloadedModules();
             bool validateSlot(bool slot);
-            void eraseSlot(bool slot);
+#ifdef ARDUINO_ARCH_RP2040
+            // the next slot has to be erased before a save, so a save on powerloss only writes
+            bool _nextSlotErased = false;
+            bool _eraseActive = false;
+            uint16_t _eraseOffset = 0;
+            uint32_t _eraseLast = 0;
+            void eraseNextSlotStep();
+            void finishEraseNextSlot();
+#endif
+            void eraseNextSlot();
             uint8_t nextVersion();
             uint8_t slotVersion(bool slot);
             uint16_t slotOffset(bool slot);
@@ -359,6 +359,7 @@ namespace OpenKNX
             }
 
             logTraceP("erase sector %i", sector);
+            EVENTTRACE_BEGIN(Stat::EventTraceFlashErase);
 
 #if defined(ARDUINO_ARCH_SAMD)
             NVMCTRL->ADDR.reg = ((uint32_t)_offset + (sector * _sectorSize)) / 2;
@@ -375,6 +376,7 @@ namespace OpenKNX
             rp2040.resumeOtherCore();
             interrupts();
 #endif
+            EVENTTRACE_END(Stat::EventTraceFlashErase);
         }
 
         void Driver::writeSector()
@@ -391,6 +393,7 @@ namespace OpenKNX
             }
 
             logTraceP("write sector %i", _bufferSector);
+            EVENTTRACE_BEGIN(Stat::EventTraceFlashWrite);
             // logHexTraceP(_buffer, _sectorSize);
 
 #if defined(ARDUINO_ARCH_SAMD)
@@ -479,6 +482,7 @@ namespace OpenKNX
             rp2040.resumeOtherCore();
             interrupts();
 #endif
+            EVENTTRACE_END(Stat::EventTraceFlashWrite);
         }
     } // namespace Flash
 } // namespace OpenKNX
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "OpenKNX/FunctionProperties.h"
+#include "OpenKNX/Facade.h"
+
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+
+namespace OpenKNX
+{
+    std::string FunctionProperties::logPrefix()
+    {
+        return "FunctionProperties";
+    }
+
+    bool FunctionProperties::add(uint8_t objectIndex, uint8_t propertyId, FunctionPropertyHandler command, FunctionPropertyHandler state /* = nullptr */)
+    {
+        if (find(objectIndex, propertyId) >= 0)
+        {
+            logErrorP("Property %u/%u is already registered", objectIndex, propertyId);
+            return false;
+        }
+
+        if (_count >= OPENKNX_MAX_FUNCTION_PROPERTIES)
+        {
+            logErrorP("Too many properties (max %u)", OPENKNX_MAX_FUNCTION_PROPERTIES);
+            return false;
+        }
+
+        // a pending operation is referenced by index
+        if (_pending >= 0)
+        {
+            logErrorP("Registration not possible while a property is pending");
+            return false;
+        }
+
+        // insert sorted
+        const uint16_t key = (objectIndex << 8) | propertyId;
+        uint8_t pos = _count;
+        while (pos > 0 && _entries[pos - 1].key > key)
+        {
+            _entries[pos] = _entries[pos - 1];
+            pos--;
+        }
+
+        _entries[pos].key = key;
+        _entries[pos].command = command;
+        _entries[pos].state = state;
+        _count++;
+        return true;
+    }
+
+    int16_t FunctionProperties::find(uint8_t objectIndex, uint8_t propertyId)
+    {
+        const uint16_t key = (objectIndex << 8) | propertyId;
+        int16_t low = 0;
+        int16_t high = (int16_t)_count - 1;
+        while (low <= high)
+        {
+            const int16_t mid = (low + high) / 2;
+            if (_entries[mid].key == key)
+                return mid;
+
+            if (_entries[mid].key < key)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+        return -1;
+    }
+
+    bool FunctionProperties::complete(uint8_t objectIndex, uint8_t propertyId, const uint8_t *resultData, uint8_t resultLength)
+    {
+        const int16_t index = find(objectIndex, propertyId);
+        if (index < 0 || index != _pending || _completed)
+        {
+            logErrorP("Property %u/%u is not pending", objectIndex, propertyId);
+            return false;
+        }
+
+        if (resultLength > OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE)
+        {
+            logErrorP("Result of property %u/%u truncated (%u > %u)", objectIndex, propertyId, resultLength, OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE);
+            resultLength = OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE;
+        }
+
+        memcpy(_result, resultData, resultLength);
+        _resultLength = resultLength;
+        _completed = true;
+        return true;
+    }
+
+    bool FunctionProperties::process(int16_t index, bool state, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength)
+    {
+        // this property is pending - return the result if available
+        if (index == _pending)
+        {
+            if (!_completed)
+            {
+                resultData[0] = OPENKNX_FUNCTION_PROPERTY_PENDING;
+                resultLength = 1;
+                return true;
+            }
+
+            // the result is delivered once, after that the property can be called again
+            if (state)
+            {
+                memcpy(resultData, _result, _resultLength);
+                resultLength = _resultLength;
+                _pending = -1;
+                _completed = false;
+                return true;
+            }
+        }
+
+        FunctionPropertyHandler &handler = state ? _entries[index].state : _entries[index].command;
+        if (!handler)
+            return false;
+
+        // another property is still running
+        if (_pending >= 0 && _pending != index)
+        {
+            resultData[0] = OPENKNX_FUNCTION_PROPERTY_BUSY;
+            resultLength = 1;
+            return true;
+        }
+
+        switch (handler(length, data, resultData, resultLength))
+        {
+            case FunctionPropertyResult::Handled:
+                // a new command replaces a completed but not fetched result
+                if (_pending == index)
+                {
+                    _pending = -1;
+                    _completed = false;
+                }
+                return true;
+
+            case FunctionPropertyResult::Pending:
+                _pending = index;
+                _completed = false;
+                resultData[0] = OPENKNX_FUNCTION_PROPERTY_PENDING;
+                resultLength = 1;
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    bool FunctionProperties::processCommand(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength)
+    {
+        const int16_t index = find(objectIndex, propertyId);
+        if (index < 0) return false;
+
+        return process(index, false, length, data, resultData, resultLength);
+    }
+
+    bool FunctionProperties::processState(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength)
+    {
+        const int16_t index = find(objectIndex, propertyId);
+        if (index < 0) return false;
+
+        return process(index, true, length, data, resultData, resultLength);
+    }
+} // namespace OpenKNX
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <functional>
+#include <string>
+
+#ifdef OPENKNX_FUNCTION_PROPERTIES
+    #ifndef OPENKNX_MAX_FUNCTION_PROPERTIES
+        #define OPENKNX_MAX_FUNCTION_PROPERTIES 16
+    #endif
+
+    #ifndef OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE
+        #define OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE 16
+    #endif
+
+    // single byte response while an asynchronous function property is running / another one blocks (see README)
+    #define OPENKNX_FUNCTION_PROPERTY_PENDING 0xFE
+    #define OPENKNX_FUNCTION_PROPERTY_BUSY 0xFD
+
+namespace OpenKNX
+{
+    enum class FunctionPropertyResult : uint8_t
+    {
+        Unhandled, // not responsible, ask the modules (processFunctionProperty)
+        Handled,   // resultData/resultLength are filled
+        Pending,   // result will be delivered later with openknx.common.completeFunctionProperty
+    };
+
+    typedef std::function<FunctionPropertyResult(uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength)> FunctionPropertyHandler;
+
+    /*
+     * Table of registered function property handlers, sorted by objectIndex and propertyId.
+     *
+     * A handler can return Pending for long running operations. The ETS then receives
+     * OPENKNX_FUNCTION_PROPERTY_PENDING and has to poll with a function property state command
+     * until the result (stored by complete()) is returned. Only one operation can be pending,
+     * other registered properties are answered with OPENKNX_FUNCTION_PROPERTY_BUSY meanwhile.
+     */
+    class FunctionProperties
+    {
+      private:
+        struct Entry
+        {
+            uint16_t key;
+            FunctionPropertyHandler command;
+            FunctionPropertyHandler state;
+        };
+
+        Entry _entries[OPENKNX_MAX_FUNCTION_PROPERTIES];
+        uint8_t _count = 0;
+
+        int16_t _pending = -1;
+        bool _completed = false;
+        uint8_t _result[OPENKNX_FUNCTION_PROPERTY_RESULT_SIZE];
+        uint8_t _resultLength = 0;
+
+        int16_t find(uint8_t objectIndex, uint8_t propertyId);
+        bool process(int16_t index, bool state, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength);
+
+      public:
+        /*
+         * Register handlers for a function property. state can be nullptr.
+         * @return false if the table is full or the property is already registered
+         */
+        bool add(uint8_t objectIndex, uint8_t propertyId, FunctionPropertyHandler command, FunctionPropertyHandler state = nullptr);
+
+        /*
+         * Store the result of a pending function property
+         * @return false if the property was not pending
+         */
+        bool complete(uint8_t objectIndex, uint8_t propertyId, const uint8_t *resultData, uint8_t resultLength);
+
+        /*
+         * @return true, if the call was handled by a registered handler
+         */
+        bool processCommand(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength);
+        bool processState(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength);
+
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
+#endif
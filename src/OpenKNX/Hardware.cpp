@@ -7,12 +7,14 @@
 #if defined(ARDUINO_ARCH_RP2040) && defined(USE_TP_RX_QUEUE) && defined(USE_KNX_DMA_UART) && defined(USE_KNX_DMA_IRQ) && (MASK_VERSION == 0x07B0 || MASK_VERSION == 0x091A)
 void __time_critical_func(processKnxRxISR)()
 {
+    EVENTTRACE_BEGIN(OpenKNX::Stat::EventTraceKnxRxISR);
     uart_get_hw(KNX_DMA_UART)->icr = UART_UARTICR_RTIC_BITS | UART_UARTICR_RXIC_BITS;
     #if MASK_VERSION == 0x07B0
     knx.bau().getDataLinkLayer()->processRxISR();
     #elif MASK_VERSION == 0x091A
     knx.bau().getSecondaryDataLinkLayer()->processRxISR();
     #endif
+    EVENTTRACE_END(OpenKNX::Stat::EventTraceKnxRxISR);
 }
 // bool __time_critical_func(processKnxRxTimer)(repeating_timer *t)
 // {
@@ -83,6 +85,7 @@ namespace OpenKNX
     void Hardware::initButtons()
     {
 #ifdef PROG_BUTTON_PIN
+        openknx.progButton.init();
         pinMode(PROG_BUTTON_PIN, INPUT_PULLUP);
         attachInterrupt(
             digitalPinToInterrupt(PROG_BUTTON_PIN),
@@ -90,6 +93,7 @@ namespace OpenKNX
 #endif
 
 #ifdef FUNC1_BUTTON_PIN
+        openknx.func1Button.init();
         pinMode(FUNC1_BUTTON_PIN, INPUT_PULLUP);
         attachInterrupt(
             digitalPinToInterrupt(FUNC1_BUTTON_PIN),
@@ -97,6 +101,7 @@ namespace OpenKNX
 #endif
 
 #ifdef FUNC2_BUTTON_PIN
+        openknx.func2Button.init();
         pinMode(FUNC2_BUTTON_PIN, INPUT_PULLUP);
         attachInterrupt(
             digitalPinToInterrupt(FUNC2_BUTTON_PIN),
@@ -104,6 +109,7 @@ namespace OpenKNX
 #endif
 
 #ifdef FUNC3_BUTTON_PIN
+        openknx.func3Button.init();
         pinMode(FUNC3_BUTTON_PIN, INPUT_PULLUP);
         attachInterrupt(
             digitalPinToInterrupt(FUNC3_BUTTON_PIN),
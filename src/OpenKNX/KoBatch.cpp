@@ -0,0 +1,86 @@
+#include "OpenKNX/KoBatch.h"
+#include "OpenKNX/Facade.h"
+
+#ifdef OPENKNX_KO_BATCH
+namespace OpenKNX
+{
+    std::string KoBatch::logPrefix()
+    {
+        return "KoBatch";
+    }
+
+    void KoBatch::init()
+    {
+        _koCount = knx.bau().groupObjectTable().entryCount();
+
+        // asap starts with 1
+        if (_dirty != nullptr) delete[] _dirty;
+        _dirty = new uint8_t[_koCount / 8 + 1];
+        memset(_dirty, 0, _koCount / 8 + 1);
+
+        _head = 0;
+        _tail = 0;
+        _size = 0;
+        _active = true;
+        logDebugP("Batching %u KOs (queue %u)", _koCount, OPENKNX_KO_BATCH_SIZE);
+    }
+
+    void KoBatch::deactivate()
+    {
+        _active = false;
+    }
+
+    bool KoBatch::add(GroupObject &ko)
+    {
+        if (!_active) return false;
+
+        const uint16_t asap = ko.asap();
+        if (asap > _koCount) return false;
+
+        _received++;
+
+        // already pending - the module will see the latest value
+        if (_dirty[asap / 8] & (1 << (asap % 8)))
+        {
+            _merged++;
+            return true;
+        }
+
+        if (_size >= OPENKNX_KO_BATCH_SIZE)
+        {
+            _overflow++;
+            return false;
+        }
+
+        _dirty[asap / 8] |= (1 << (asap % 8));
+        _queue[_head] = asap;
+        _head = (_head + 1) % OPENKNX_KO_BATCH_SIZE;
+        _size++;
+        if (_size > _sizeMax) _sizeMax = _size;
+        return true;
+    }
+
+    bool KoBatch::pop(uint16_t &asap)
+    {
+        if (!_active || _size == 0) return false;
+
+        asap = _queue[_tail];
+        _tail = (_tail + 1) % OPENKNX_KO_BATCH_SIZE;
+        _size--;
+        _dirty[asap / 8] &= ~(1 << (asap % 8));
+        _delivered++;
+        return true;
+    }
+
+    uint16_t KoBatch::size()
+    {
+        return _size;
+    }
+
+    void KoBatch::showStatus()
+    {
+        logInfoP("%s - %u KOs, pending %u (max %u of %u)", _active ? "active" : "inactive", _koCount, _size, _sizeMax, OPENKNX_KO_BATCH_SIZE);
+        logInfoP("Received: %u  Merged: %u  Overflow (flushed): %u  Delivered: %u", _received, _merged, _overflow, _delivered);
+    }
+} // namespace OpenKNX
+#endif
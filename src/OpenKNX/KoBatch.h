@@ -0,0 +1,65 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <knx.h>
+#include <string>
+
+#ifndef OPENKNX_KO_BATCH_SIZE
+    #define OPENKNX_KO_BATCH_SIZE 64
+#endif
+
+namespace OpenKNX
+{
+    /*
+     * Collects changed GroupObjects during knx.loop() to deliver them once per loop (OPENKNX_KO_BATCH).
+     *
+     * A dirty bit per KO coalesces repeated updates of the same KO, so modules see only the latest value.
+     * The order of the first update of each KO is kept by a bounded queue. If the queue is full,
+     * the caller has to deliver the pending KOs first and add the GroupObject again.
+     */
+    class KoBatch
+    {
+      private:
+        uint8_t *_dirty = nullptr;
+        uint16_t _koCount = 0;
+        uint16_t _queue[OPENKNX_KO_BATCH_SIZE];
+        uint16_t _head = 0;
+        uint16_t _tail = 0;
+        uint16_t _size = 0;
+        uint16_t _sizeMax = 0;
+        bool _active = false;
+
+        uint32_t _received = 0;
+        uint32_t _merged = 0;
+        uint32_t _overflow = 0;
+        uint32_t _delivered = 0;
+
+      public:
+        /*
+         * Allocate the dirty bits for all KOs of the group object table (knx must be configured)
+         */
+        void init();
+
+        /*
+         * Stop batching (e.g. before the tables are unloaded)
+         */
+        void deactivate();
+
+        /*
+         * Mark the GroupObject for delivery
+         * @return false if the GroupObject must be delivered immediately (batch full or inactive)
+         */
+        bool add(GroupObject &ko);
+
+        /*
+         * Take the next KO for delivery. The KO can be added again afterwards.
+         * @return false if no KO is pending
+         */
+        bool pop(uint16_t &asap);
+
+        uint16_t size();
+
+        void showStatus();
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
@@ -0,0 +1,148 @@
+#include "OpenKNX/KoRouting.h"
+#include "OpenKNX/Facade.h"
+
+static_assert(OPENKNX_MAX_MODULES <= 32, "KoRouting supports max 32 modules");
+
+namespace OpenKNX
+{
+    std::string KoRouting::logPrefix()
+    {
+        return "KoRouting";
+    }
+
+    bool KoRouting::add(uint8_t module, uint16_t first, uint16_t last)
+    {
+        _dirty = true;
+        _registeredModules |= (1UL << module);
+
+        if (_rangeCount >= OPENKNX_MAX_KO_RANGES)
+        {
+            logErrorP("Too many ranges (max %u) - module %u will receive all GroupObjects", OPENKNX_MAX_KO_RANGES, module);
+            _overflowModules |= (1UL << module);
+            return false;
+        }
+
+        if (first > last)
+        {
+            const uint16_t temp = first;
+            first = last;
+            last = temp;
+        }
+
+        _ranges[_rangeCount].first = first;
+        _ranges[_rangeCount].last = last;
+        _ranges[_rangeCount].module = module;
+        _rangeCount++;
+        return true;
+    }
+
+    void KoRouting::build()
+    {
+        _dirty = false;
+
+        // collect all borders (first and last + 1) sorted and unique
+        uint32_t borders[OPENKNX_MAX_KO_RANGES * 2];
+        uint8_t borderCount = 0;
+        for (uint8_t i = 0; i < _rangeCount; i++)
+        {
+            const uint32_t candidates[2] = {_ranges[i].first, (uint32_t)_ranges[i].last + 1};
+            for (uint8_t c = 0; c < 2; c++)
+            {
+                uint8_t pos = 0;
+                while (pos < borderCount && borders[pos] < candidates[c])
+                    pos++;
+
+                if (pos < borderCount && borders[pos] == candidates[c])
+                    continue;
+
+                for (uint8_t j = borderCount; j > pos; j--)
+                    borders[j] = borders[j - 1];
+
+                borders[pos] = candidates[c];
+                borderCount++;
+            }
+        }
+
+        // create segments and merge neighbours with same modules
+        _segmentCount = 0;
+        for (uint8_t b = 0; b < borderCount; b++)
+        {
+            // last border of max asap has no following segment
+            if (borders[b] > 0xFFFF) break;
+
+            uint32_t modules = 0;
+            for (uint8_t i = 0; i < _rangeCount; i++)
+                if (_ranges[i].first <= borders[b] && borders[b] <= _ranges[i].last)
+                    modules |= (1UL << _ranges[i].module);
+
+            if (_segmentCount > 0 && _segments[_segmentCount - 1].modules == modules)
+                continue;
+
+            // segment before first border is not needed, because it has no modules
+            if (_segmentCount == 0 && modules == 0)
+                continue;
+
+            _segments[_segmentCount].first = borders[b];
+            _segments[_segmentCount].modules = modules;
+            _segmentCount++;
+        }
+    }
+
+    uint32_t __time_critical_func(KoRouting::lookup)(uint16_t asap)
+    {
+        if (_dirty) build();
+        _lookups++;
+
+        // modules without registered range receive everything (and the ones with too many ranges)
+        uint32_t modules = (~_registeredModules | _overflowModules);
+
+        // binary search of the last segment with first <= asap
+        int16_t low = 0;
+        int16_t high = (int16_t)_segmentCount - 1;
+        while (low <= high)
+        {
+            const int16_t mid = (low + high) / 2;
+            if (_segments[mid].first <= asap)
+            {
+                if (mid == _segmentCount - 1 || _segments[mid + 1].first > asap)
+                    return modules | _segments[mid].modules;
+
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+
+        return modules;
+    }
+
+    void KoRouting::countDeliveries(uint8_t count)
+    {
+        _deliveries += count;
+    }
+
+    void KoRouting::showStatus()
+    {
+        if (_dirty) build();
+
+        logInfoP("Ranges: %u/%u  Segments: %u", _rangeCount, OPENKNX_MAX_KO_RANGES, _segmentCount);
+        logIndentUp();
+        for (uint8_t i = 0; i < _segmentCount; i++)
+        {
+            const uint32_t last = (i + 1 < _segmentCount) ? _segments[i + 1].first - 1 : 0xFFFF;
+            logInfoP("KO %5u - %5u: 0x%08X", _segments[i].first, last, _segments[i].modules);
+        }
+        logIndentDown();
+
+        for (uint8_t i = 0; i < openknx.modules.count; i++)
+        {
+            const bool all = !(_registeredModules & (1UL << i)) || (_overflowModules & (1UL << i));
+            logInfoP("Module %u (%s): %s", i, openknx.modules.list[i]->name().c_str(), all ? "all" : "ranges");
+        }
+
+        logInfoP("Lookups: %u  Deliveries: %u (%u.%02u per KO, %u modules)", _lookups, _deliveries,
+                 _lookups ? _deliveries / _lookups : 0, _lookups ? (_deliveries * 100 / _lookups) % 100 : 0, openknx.modules.count);
+    }
+} // namespace OpenKNX
@@ -0,0 +1,69 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+#ifndef OPENKNX_MAX_KO_RANGES
+    #define OPENKNX_MAX_KO_RANGES 32
+#endif
+
+namespace OpenKNX
+{
+    /*
+     * Lookup table to deliver incoming GroupObjects only to the modules, which have registered
+     * a matching KO range (openknx.common.registerInputKoRange). Modules without any registered
+     * range will still receive all GroupObjects.
+     *
+     * The ranges are merged into sorted, non overlapping segments with a bitmask of the interested
+     * modules, so a lookup is a binary search over the segments.
+     */
+    class KoRouting
+    {
+      private:
+        struct Range
+        {
+            uint16_t first;
+            uint16_t last;
+            uint8_t module;
+        };
+
+        struct Segment
+        {
+            uint16_t first; // segment ends before first of next segment
+            uint32_t modules;
+        };
+
+        Range _ranges[OPENKNX_MAX_KO_RANGES];
+        Segment _segments[OPENKNX_MAX_KO_RANGES * 2 + 1];
+        uint8_t _rangeCount = 0;
+        uint8_t _segmentCount = 0;
+        uint32_t _registeredModules = 0;
+        uint32_t _overflowModules = 0;
+        bool _dirty = true;
+
+        uint32_t _lookups = 0;
+        uint32_t _deliveries = 0;
+
+        void build();
+
+      public:
+        /*
+         * Register a range of KO numbers (asap) for the module
+         * @return false if no more ranges can be registered (the module will receive all GroupObjects)
+         */
+        bool add(uint8_t module, uint16_t first, uint16_t last);
+
+        /*
+         * @return bitmask of the modules (index in openknx.modules) which should receive the GroupObject
+         */
+        uint32_t lookup(uint16_t asap);
+
+        /*
+         * Count delivered calls for statistic
+         */
+        void countDeliveries(uint8_t count);
+
+        void showStatus();
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
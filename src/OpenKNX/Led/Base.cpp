@@ -11,41 +11,60 @@ namespace OpenKNX
             // no valid pin
             if (_pin < 0) return;
 
-            _lastMillis = millis();
+            // nothing changed and no transition of the effect is due
+            const uint32_t now = millis();
+            if (!_dirty && (int32_t)(now - _nextUpdate) < 0) return;
+
+            // reset before the update, so a concurrent change is processed on the next call
+            _dirty = false;
+            _lastMillis = now;
+            _nextUpdate = update(now);
+        }
 
+        /*
+         * Evaluate the priorities and write the led
+         * @return time (millis) of the next possible change
+         */
+        uint32_t __time_critical_func(Base::update)(uint32_t now)
+        {
             // PowerSave (Prio 1)
             if (_powerSave)
             {
                 writeLed(false);
-                return;
+                return now + Effects::IdleInterval;
             }
 
             // FatalError (Prio 2)
             if (_errorMode)
             {
-                writeLed(_errorEffect->value());
-                return;
+#ifdef OPENKNX_LED_HWPWM
+                // replayed by hardware (started by hardwareSync)
+                if (_hardwareEffect == (0x200 | _errorEffect.code()))
+                    return now + Effects::IdleInterval;
+#endif
+                writeLed(_errorEffect.value());
+                return _errorEffect.nextUpdate(now);
             }
 
             // Debug (Prio 3)
 #ifdef OPENKNX_HEARTBEAT
-            // debug mode enable
+            // debug mode enable - polled because of the heartbeat
             if (_debugMode)
             {
     #ifdef OPENKNX_HEARTBEAT_PRIO
                 // Blinking until the heartbeat signal stops.
-                if (!(millis() - _debugHeartbeat >= OPENKNX_HEARTBEAT))
-                    writeLed(_debugEffect->value());
+                if (!(now - _debugHeartbeat >= OPENKNX_HEARTBEAT))
+                    writeLed(_debugEffect.value());
                 else
                     writeLed(false);
 
-                return;
+                return now;
     #else
                 // Blinks as soon as the heartbeat signal stops.
-                if ((millis() - _debugHeartbeat >= OPENKNX_HEARTBEAT))
+                if ((now - _debugHeartbeat >= OPENKNX_HEARTBEAT))
                 {
-                    writeLed(_debugEffect->value());
-                    return;
+                    writeLed(_debugEffect.value());
+                    return now;
                 }
     #endif
             }
@@ -55,20 +74,48 @@ namespace OpenKNX
             if (_forceOn)
             {
                 writeLed(true);
-                return;
+#if defined(OPENKNX_HEARTBEAT) && !defined(OPENKNX_HEARTBEAT_PRIO)
+                if (_debugMode) return now;
+#endif
+                return now + Effects::IdleInterval;
             }
 
             // Normal with optional Effect (Prio 5)
-            if (_state)
+            uint32_t next = now + Effects::IdleInterval;
+            if (_state && _effectMode)
             {
-                if (_effectMode)
-                    writeLed(_effect->value());
-                else
-                    writeLed(true);
-                return;
+#ifdef OPENKNX_LED_HWPWM
+                if (_hardwareEffect == (uint16_t)(_effectGeneration + 1))
+                    return now + Effects::IdleInterval;
+#endif
+                writeLed(effectValue(now, next));
             }
+            else
+                writeLed(_state);
+
+#if defined(OPENKNX_HEARTBEAT) && !defined(OPENKNX_HEARTBEAT_PRIO)
+            if (_debugMode) return now;
+#endif
+            return next;
+        }
+
+        /*
+         * The output has to be evaluated again
+         */
+        void __time_critical_func(Base::changed)()
+        {
+#ifdef OPENKNX_LED_HWPWM
+            hardwareSync();
+#endif
+            _dirty = true;
+#ifdef OPENKNX_TICKLESS
+            openknx.timerInterrupt.wakeup();
+#endif
+        }
 
-            writeLed(false);
+        uint32_t Base::nextUpdate()
+        {
+            return _dirty ? millis() : _nextUpdate;
         }
 
         void Base::brightness(uint8_t brightness)
@@ -77,8 +124,11 @@ namespace OpenKNX
             if (_pin < 0) return;
             if (brightness > 100) brightness = 100;
 
+            if (_maxBrightness == brightness) return;
+
             logTraceP("brightness %i", brightness);
             _maxBrightness = brightness;
+            changed();
         }
 
         void Base::powerSave(bool active /* = true */)
@@ -86,8 +136,11 @@ namespace OpenKNX
             // no valid pin
             if (_pin < 0) return;
 
+            if (_powerSave == active) return;
+
             logTraceP("powerSave %i", active);
             _powerSave = active;
+            changed();
         }
 
         void Base::forceOn(bool active /* = true */)
@@ -95,11 +148,14 @@ namespace OpenKNX
             // no valid pin
             if (_pin < 0) return;
 
+            if (_forceOn == active) return;
+
             logTraceP("forceOn %i", active);
             _forceOn = active;
+            changed();
 #ifdef OPENKNX_HEARTBEAT_PRIO
             if (_debugMode)
-                _debugEffect->updateFrequency(active ? OPENKNX_HEARTBEAT_PRIO_ON_FREQ : OPENKNX_HEARTBEAT_PRIO_OFF_FREQ);
+                _debugEffect.updateFrequency(active ? OPENKNX_HEARTBEAT_PRIO_ON_FREQ : OPENKNX_HEARTBEAT_PRIO_OFF_FREQ);
 #endif
         }
 
@@ -109,14 +165,14 @@ namespace OpenKNX
             if (_pin < 0) return;
 
             _errorMode = false;
-            if (_errorMode) delete _errorEffect;
 
             if (code > 0)
             {
                 logTraceP("errorCode %i", code);
-                _errorEffect = new Led::Effects::Error(code);
+                _errorEffect.updateCode(code);
                 _errorMode = true;
             }
+            changed();
         }
 
         void Base::on(bool active /* = true */)
@@ -124,9 +180,12 @@ namespace OpenKNX
             // no valid pin
             if (_pin < 0) return;
 
+            if (_state == active && !_effectMode) return;
+
             logTraceP("on");
             unloadEffect();
             _state = active;
+            changed();
         }
 
         void Base::pulsing(uint16_t frequency)
@@ -135,8 +194,9 @@ namespace OpenKNX
             if (_pin < 0) return;
 
             logTraceP("pulsing (frequency %i)", frequency);
-            loadEffect(new Led::Effects::Pulse(frequency));
+            emplaceEffect<Led::Effects::Pulse>(frequency);
             _state = true;
+            changed();
         }
 
         void Base::blinking(uint16_t frequency)
@@ -145,8 +205,9 @@ namespace OpenKNX
             if (_pin < 0) return;
 
             logTraceP("blinking (frequency %i)", frequency);
-            loadEffect(new Led::Effects::Blink(frequency));
+            emplaceEffect<Led::Effects::Blink>(frequency);
             _state = true;
+            changed();
         }
 
         void Base::flash(uint16_t duration)
@@ -155,8 +216,9 @@ namespace OpenKNX
             if (_pin < 0) return;
 
             logTraceP("flash (duration %i ms)", duration);
-            loadEffect(new Led::Effects::Flash(duration));
+            emplaceEffect<Led::Effects::Flash>(duration);
             _state = true;
+            changed();
         }
 
         void Base::activity(uint32_t &lastActivity, bool inverted)
@@ -165,8 +227,9 @@ namespace OpenKNX
             if (_pin < 0) return;
 
             logTraceP("activity");
-            loadEffect(new Led::Effects::Activity(lastActivity, inverted));
+            emplaceEffect<Led::Effects::Activity>(lastActivity, inverted);
             _state = true;
+            changed();
         }
 
         void Base::off()
@@ -174,9 +237,12 @@ namespace OpenKNX
             // no valid pin
             if (_pin < 0) return;
 
+            if (!_state && !_effectMode) return;
+
             logTraceP("off");
             unloadEffect();
             _state = false;
+            changed();
         }
 
         /*
@@ -187,18 +253,68 @@ namespace OpenKNX
             writeLed((uint8_t)(state ? 255 : 0));
         }
 
+#ifdef OPENKNX_LED_HWPWM
+        /*
+         * Start or stop the effect replayed by hardware for the current state. Called by the setters (loop context), so the
+         * dma channels are never claimed or released in the interrupt. The interrupt only skips the led while it runs.
+         */
+        void Base::hardwareSync()
+        {
+            Led::Effects::Base *effect = nullptr;
+            uint16_t key = 0;
+
+            // the same priorities as in update - the debug mode is polled and always done by software
+            if (_powerSave)
+                ;
+            else if (_errorMode)
+            {
+                effect = &_errorEffect;
+                key = 0x200 | _errorEffect.code();
+            }
+    #ifdef OPENKNX_HEARTBEAT
+            else if (_debugMode)
+                ;
+    #endif
+            else if (_forceOn)
+                ;
+            else if (_state && _effectMode)
+            {
+                // the setters are the writer of the slots, so the active slot can not change here
+                effect = effectSlot(_effectGeneration & 1);
+                key = (uint16_t)(_effectGeneration + 1);
+            }
+
+            if (effect != nullptr && effect->period() == 0)
+                key = 0;
+
+            if (_hardwareEffect == key && (key == 0 || _hardwareBrightness == _maxBrightness))
+                return;
+
+            // the interrupt keeps its hands off the led until the effect is stopped
+            if (_hardwareEffect)
+            {
+                stopEffect();
+                _hardwareEffect = 0;
+            }
+
+            if (key == 0)
+                return;
+
+            _hardwareEffect = key;
+            _hardwareBrightness = _maxBrightness;
+            if (!startEffect(effect))
+                _hardwareEffect = 0;
+        }
+#endif
+
 #ifdef OPENKNX_HEARTBEAT
         void Base::debugLoop()
         {
-            // Enable Debug Mode on first run
+            // Enable Debug Mode on first run (polled afterwards)
             if (!_debugMode)
             {
-    #ifdef OPENKNX_HEARTBEAT_PRIO
-                _debugEffect = new Led::Effects::Blink(OPENKNX_HEARTBEAT_PRIO_OFF_FREQ);
-    #else
-                _debugEffect = new Led::Effects::Blink(OPENKNX_HEARTBEAT_FREQ);
-    #endif
                 _debugMode = true;
+                changed();
             }
 
             _debugHeartbeat = millis();
@@ -210,17 +326,69 @@ namespace OpenKNX
             if (_effectMode)
             {
                 logTraceP("unload effect");
+                // the object is destructed when the slot is reused
                 _effectMode = false;
-                delete _effect;
             }
         }
 
         void Base::loadEffect(Led::Effects::Base *effect)
         {
-            unloadEffect();
+            emplaceEffect<Led::Effects::Custom>(effect);
+        }
+
+        uint8_t Base::effectGeneration()
+        {
+            return _effectGeneration;
+        }
+
+        Led::Effects::Base *Base::effectSlot(uint8_t slot)
+        {
+            return reinterpret_cast<Led::Effects::Base *>(_effectStorage[slot]);
+        }
+
+        /*
+         * Construct the next effect in the unused slot. Waits if a reader on the other core still uses it.
+         * @return memory for the effect
+         */
+        void *Base::prepareEffectSlot()
+        {
+            const uint8_t slot = (_effectGeneration + 1) & 1;
+            while (_effectReading == slot + 1)
+                continue;
+
+            if (_effectConstructed[slot])
+                effectSlot(slot)->~Base();
+
+            _effectConstructed[slot] = true;
+            return _effectStorage[slot];
+        }
+
+        void Base::activateEffect()
+        {
             logTraceP("load effect");
-            _effect = effect;
+            _effectGeneration++;
             _effectMode = true;
+            changed();
+        }
+
+        uint8_t __time_critical_func(Base::effectValue)(uint32_t now, uint32_t &next)
+        {
+            // announce the slot before checking it is still active - the writer checks in the reverse order
+            const uint8_t slot = _effectGeneration & 1;
+            _effectReading = slot + 1;
+            // otherwise keep the last value - the next call uses the new effect
+            if ((_effectGeneration & 1) == slot)
+            {
+                _effectValue = effectSlot(slot)->value();
+                next = effectSlot(slot)->nextUpdate(now);
+            }
+            else
+            {
+                next = now;
+            }
+
+            _effectReading = 0;
+            return _effectValue;
         }
 
         std::string Base::logPrefix()
@@ -7,12 +7,23 @@
 #include "OpenKNX/Log/Logger.h"
 #include "OpenKNX/defines.h"
 #include <Arduino.h>
+#include <atomic>
+#include <new>
 #include <string>
 
 namespace OpenKNX
 {
     namespace Led
     {
+        constexpr size_t maxEffectSize(size_t a, size_t b)
+        {
+            return a > b ? a : b;
+        }
+
+        // storage for one effect object (the largest effect class)
+        constexpr size_t EffectSize = maxEffectSize(maxEffectSize(sizeof(Effects::Pulse), sizeof(Effects::Blink)),
+                                                    maxEffectSize(maxEffectSize(sizeof(Effects::Flash), sizeof(Effects::Activity)), sizeof(Effects::Custom)));
+
         class Base
         {
           protected:
@@ -25,16 +36,58 @@ namespace OpenKNX
             volatile bool _forceOn = false;
             volatile uint8_t _currentLedBrightness = 0;
 
+            // the led is only updated if something is changed or the next transition of the effect is due
+            volatile bool _dirty = true;
+            volatile uint32_t _nextUpdate = 0;
+            uint32_t update(uint32_t now);
+            void changed();
+
+            /*
+             * The effects are constructed in place (no heap) in two slots. A new effect is constructed in the
+             * unused slot and activated by incrementing the generation (slot = generation & 1).
+             * The reader (interrupt or other core) announces the slot it uses, so it is never overwritten while in use.
+             */
             volatile bool _effectMode = false;
-            Led::Effects::Base *_effect = nullptr;
+            alignas(Led::Effects::Base) uint8_t _effectStorage[2][EffectSize];
+            bool _effectConstructed[2] = {false, false};
+            std::atomic<uint8_t> _effectGeneration{0};
+            std::atomic<uint8_t> _effectReading{0}; // slot + 1 or 0
+            volatile uint8_t _effectValue = 0;
+
+            Led::Effects::Base *effectSlot(uint8_t slot);
+            uint8_t effectValue(uint32_t now, uint32_t &next);
+            void *prepareEffectSlot();
+            void activateEffect();
 
             volatile bool _errorMode = false;
-            Led::Effects::Error *_errorEffect = nullptr;
+            Led::Effects::Error _errorEffect;
 
 #ifdef OPENKNX_HEARTBEAT
             volatile bool _debugMode = false;
             volatile uint32_t _debugHeartbeat = 0;
-            Led::Effects::Blink *_debugEffect = nullptr;
+    #ifdef OPENKNX_HEARTBEAT_PRIO
+            Led::Effects::Blink _debugEffect = Led::Effects::Blink(OPENKNX_HEARTBEAT_PRIO_OFF_FREQ);
+    #else
+            Led::Effects::Blink _debugEffect = Led::Effects::Blink(OPENKNX_HEARTBEAT_FREQ);
+    #endif
+#endif
+
+#ifdef OPENKNX_LED_HWPWM
+            /*
+             * Periodic effects (see Effects::Base::period) can be replayed by the hardware of the led.
+             * The key identifies the running effect (normal effect: generation + 1, error effect: 0x200 | code).
+             * The effect is started and stopped by hardwareSync in loop context, the interrupt only compares the key.
+             */
+            volatile uint16_t _hardwareEffect = 0;
+            volatile uint8_t _hardwareBrightness = 0;
+            void hardwareSync();
+
+            /*
+             * Start replaying the effect by hardware (scaled by _maxBrightness) - loop context only
+             * @return false if not supported, the effect is evaluated by value() then
+             */
+            virtual bool startEffect(Led::Effects::Base *effect) { return false; };
+            virtual void stopEffect() {};
 #endif
 
             /*
@@ -49,9 +102,15 @@ namespace OpenKNX
           public:
             /*
              * use in normal loop or loop1
+             * Returns immediately if the output can not change (see nextUpdate)
              */
             void loop();
 
+            /*
+             * Time (millis) of the next possible change of the output, if the led is not changed before
+             */
+            uint32_t nextUpdate();
+
             /*
              * Configure a max brightness
              */
@@ -130,10 +189,28 @@ namespace OpenKNX
             void unloadEffect();
 
             /*
-             * Call unloadEffect() and load new normal effect
+             * Load a new normal effect, which is constructed in place (without heap allocation)
+             *   led.emplaceEffect<MyEffect>(arg1, arg2);
+             */
+            template <class T, class... Args>
+            void emplaceEffect(Args &&...args)
+            {
+                static_assert(sizeof(T) <= EffectSize, "Effect is too large for the in place storage");
+                new (prepareEffectSlot()) T(std::forward<Args>(args)...);
+                activateEffect();
+            }
+
+            /*
+             * Load new normal effect allocated by the caller (deleted by the led)
+             * Hint: Prefer emplaceEffect to avoid heap allocations
              */
             void loadEffect(Led::Effects::Base *effect);
 
+            /*
+             * Incremented on each change of the normal effect
+             */
+            uint8_t effectGeneration();
+
             /*
              * Get a logPrefix as string
              */
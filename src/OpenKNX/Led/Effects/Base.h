@@ -10,6 +10,9 @@ namespace OpenKNX
     {
         namespace Effects
         {
+            // interval for "no change until the led is changed" (wrap safe compare with millis)
+            constexpr uint32_t IdleInterval = 0x3FFFFFFF;
+
             class Base
             {
               protected:
@@ -17,8 +20,39 @@ namespace OpenKNX
 
               public:
                 virtual uint8_t value() = 0;
+                /*
+                 * Time (millis) when the value can change next. Called after value().
+                 * The default polls the effect each timer interrupt.
+                 */
+                virtual uint32_t nextUpdate(uint32_t now) { return now; };
+                /*
+                 * Length (ms) of one period of a periodic effect, which can be replayed by hardware (OPENKNX_LED_HWPWM).
+                 * 0 = not periodic, the effect is evaluated by value()
+                 */
+                virtual uint32_t period() { return 0; };
+                /*
+                 * Value at the offset (ms) within one period, starting with the first value of value()
+                 */
+                virtual uint8_t valueAt(uint32_t offset) { return 0; };
                 virtual ~Base() {};
             };
+
+            /*
+             * Wrapper for effects allocated by the caller (Led::Base::loadEffect). Takes the ownership.
+             */
+            class Custom : public Base
+            {
+              protected:
+                Base *_effect;
+
+              public:
+                Custom(Base *effect) : _effect(effect) {};
+                ~Custom() { delete _effect; };
+                uint8_t value() override { return _effect->value(); };
+                uint32_t nextUpdate(uint32_t now) override { return _effect->nextUpdate(now); };
+                uint32_t period() override { return _effect->period(); };
+                uint8_t valueAt(uint32_t offset) override { return _effect->valueAt(offset); };
+            };
         } // namespace Effects
     } // namespace Led
 } // namespace OpenKNX
\ No newline at end of file
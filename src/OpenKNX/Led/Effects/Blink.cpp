@@ -27,6 +27,21 @@ namespace OpenKNX
 
                 return _state ? 255 : 0;
             }
+
+            uint32_t __time_critical_func(Blink::nextUpdate)(uint32_t now)
+            {
+                return _lastMillis == 0 ? now : _lastMillis + _frequency;
+            }
+
+            uint32_t Blink::period()
+            {
+                return (uint32_t)_frequency * 2;
+            }
+
+            uint8_t Blink::valueAt(uint32_t offset)
+            {
+                return offset < _frequency ? 255 : 0;
+            }
         } // namespace Effects
     } // namespace Led
 } // namespace OpenKNX
\ No newline at end of file
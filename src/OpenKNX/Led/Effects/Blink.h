@@ -22,6 +22,9 @@ namespace OpenKNX
                 Blink(uint16_t frequency = OPENKNX_LEDEFFECT_BLINK_FREQ);
                 ~Blink() {};
                 uint8_t value() override;
+                uint32_t nextUpdate(uint32_t now) override;
+                uint32_t period() override;
+                uint8_t valueAt(uint32_t offset) override;
                 void updateFrequency(uint16_t frequency);
             };
         } // namespace Effects
@@ -1,5 +1,4 @@
-#include "OpenKNX/Facade.h"
-#include "OpenKNX/Led/Effects/Blink.h"
+#include "OpenKNX/Led/Effects/Error.h"
 
 namespace OpenKNX
 {
@@ -12,6 +11,19 @@ namespace OpenKNX
                 _code = code;
             }
 
+            void Error::updateCode(uint8_t code)
+            {
+                _code = code;
+                _counter = 0;
+                _state = false;
+                _lastMillis = 0;
+            }
+
+            uint8_t Error::code()
+            {
+                return _code;
+            }
+
             uint8_t __time_critical_func(Error::value)()
             {
                 if (
@@ -32,6 +44,24 @@ namespace OpenKNX
 
                 return _state ? 255 : 0;
             }
+
+            uint32_t __time_critical_func(Error::nextUpdate)(uint32_t now)
+            {
+                if (_lastMillis == 0) return now;
+                return _lastMillis + (_counter < _code ? 250 : 1500);
+            }
+
+            uint32_t Error::period()
+            {
+                // code x (250 on + 250 off) with the last off extended to 1500
+                return (uint32_t)_code * 500 + 1250;
+            }
+
+            uint8_t Error::valueAt(uint32_t offset)
+            {
+                if (offset >= (uint32_t)_code * 500) return 0;
+                return (offset / 250) % 2 ? 0 : 255;
+            }
         } // namespace Effects
     } // namespace Led
 } // namespace OpenKNX
\ No newline at end of file
@@ -15,9 +15,14 @@ namespace OpenKNX
                 bool _state = false;
 
               public:
-                Error(uint8_t code);
+                Error(uint8_t code = 1);
                 ~Error() {};
+                void updateCode(uint8_t code);
+                uint8_t code();
                 uint8_t value() override;
+                uint32_t nextUpdate(uint32_t now) override;
+                uint32_t period() override;
+                uint8_t valueAt(uint32_t offset) override;
             };
         } // namespace Effects
     } // namespace Led
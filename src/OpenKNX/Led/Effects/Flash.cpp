@@ -17,6 +17,12 @@ namespace OpenKNX
                 _state = !delayCheck(_lastMillis, _duration);
                 return _state ? 255 : 0;
             }
+
+            uint32_t __time_critical_func(Flash::nextUpdate)(uint32_t now)
+            {
+                // stays off after the flash
+                return _state ? _lastMillis + _duration : now + IdleInterval;
+            }
         } // namespace Effects
     } // namespace Led
 } // namespace OpenKNX
\ No newline at end of file
@@ -23,6 +23,7 @@ namespace OpenKNX
                 Flash(uint16_t duration = OPENKNX_LEDEFFECT_FLASH_DURATION);
                 ~Flash() {};
                 uint8_t value() override;
+                uint32_t nextUpdate(uint32_t now) override;
             };
         } // namespace Effects
     } // namespace Led
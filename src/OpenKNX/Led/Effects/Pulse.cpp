@@ -1,4 +1,5 @@
 #include "OpenKNX/Led/Effects/Pulse.h"
+#include "OpenKNX/Led/Effects/Waveform.h"
 
 namespace OpenKNX
 {
@@ -9,6 +10,7 @@ namespace OpenKNX
             Pulse::Pulse(uint16_t frequency)
             {
                 _frequency = frequency;
+                _phaseStep = Waveform::phaseStep(period());
             }
 
             uint8_t __time_critical_func(Pulse::value)()
@@ -16,8 +18,35 @@ namespace OpenKNX
                 // first run
                 if (_lastMillis == 0) _lastMillis = millis();
 
-                constexpr uint8_t refval = 255 - OPENKNX_LEDEFFECT_PULSE_MIN;
-                return (0.5 * (1 + sin(PI * ((millis() - _lastMillis) % (_frequency * 2)) / 1000.0)) * refval) + OPENKNX_LEDEFFECT_PULSE_MIN;
+                // the phase wraps with the period, so no modulo is needed
+                return level((millis() - _lastMillis) * _phaseStep);
+            }
+
+            uint32_t Pulse::period()
+            {
+                return (uint32_t)_frequency * 2;
+            }
+
+            uint8_t __time_critical_func(Pulse::valueAt)(uint32_t offset)
+            {
+                return level(offset * _phaseStep);
+            }
+
+            uint8_t __time_critical_func(Pulse::level)(uint32_t phase)
+            {
+                // integer only and no division, because it is called in the timer interrupt (no fpu and divider on samd)
+                constexpr uint16_t refval = 255 - OPENKNX_LEDEFFECT_PULSE_MIN;
+                uint8_t value = Waveform::at(Waveform::sine, phase);
+#ifdef OPENKNX_LEDEFFECT_GAMMA
+                value = Waveform::gamma[value];
+#endif
+                return (((uint16_t)value * (refval + 1)) >> 8) + OPENKNX_LEDEFFECT_PULSE_MIN;
+            }
+
+            uint32_t __time_critical_func(Pulse::nextUpdate)(uint32_t now)
+            {
+                // one step of the table
+                return now + MAX(1, (uint32_t)_frequency >> 7);
             }
         } // namespace Effects
     } // namespace Led
@@ -19,11 +19,18 @@ namespace OpenKNX
             {
               protected:
                 uint16_t _frequency = 0;
+                // phase accumulator increment per ms (see Waveform)
+                uint32_t _phaseStep = 0;
+
+                uint8_t level(uint32_t phase);
 
               public:
                 Pulse(uint16_t frequency = OPENKNX_LEDEFFECT_PULSE_FREQ);
                 ~Pulse() {};
                 uint8_t value() override;
+                uint32_t nextUpdate(uint32_t now) override;
+                uint32_t period() override;
+                uint8_t valueAt(uint32_t offset) override;
             };
         } // namespace Effects
     } // namespace Led
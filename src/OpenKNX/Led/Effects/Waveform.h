@@ -0,0 +1,33 @@
+#pragma once
+#include "OpenKNX/Led/Effects/Base.h"
+
+namespace OpenKNX
+{
+    namespace Led
+    {
+        namespace Effects
+        {
+            /*
+             * Precomputed waveforms of the built-in effects, so the timer interrupt needs no floating point.
+             * A table is indexed by the upper byte of a 32 bit phase accumulator (one period = 2^32).
+             */
+            class Waveform
+            {
+              public:
+                // one period of (1 + sin) / 2 scaled to 0-255
+                static const uint8_t sine[256];
+#ifdef OPENKNX_LEDEFFECT_GAMMA
+                // perceived brightness (gamma 2.2), 0 and 255 are unchanged
+                static const uint8_t gamma[256];
+#endif
+
+                /*
+                 * Phase increment per ms for the period (ms). Calculated once, so the interrupt needs no division.
+                 */
+                static uint32_t phaseStep(uint32_t period);
+
+                static inline uint8_t at(const uint8_t *table, uint32_t phase) { return table[phase >> 24]; };
+            };
+        } // namespace Effects
+    } // namespace Led
+} // namespace OpenKNX
@@ -1,10 +1,24 @@
 #include "OpenKNX/Led/GPIO.h"
 #include "OpenKNX/Facade.h"
 
+#ifdef OPENKNX_LED_HWPWM_RP2040
+    #include "hardware/clocks.h"
+    #include "hardware/dma.h"
+    #include "hardware/gpio.h"
+    #include "hardware/pwm.h"
+
+static_assert((OPENKNX_LED_HWPWM_STEPS & (OPENKNX_LED_HWPWM_STEPS - 1)) == 0 && OPENKNX_LED_HWPWM_STEPS <= 16384, "OPENKNX_LED_HWPWM_STEPS must be a power of two (max 16384)");
+#endif
+
 namespace OpenKNX
 {
     namespace Led
     {
+#ifdef OPENKNX_LED_HWPWM_RP2040
+        int GPIO::_dmaTimer = -1;
+        uint32_t GPIO::_dmaDummy = 0;
+#endif
+
         void GPIO::init(long pin /* = -1 */, long activeOn /* = HIGH */)
         {
             // no valid pin
@@ -16,6 +30,12 @@ namespace OpenKNX
 
             pinMode(_pin, OUTPUT);
             digitalWrite(_pin, LOW);
+
+#ifdef OPENKNX_LED_HWPWM_RP2040
+            // the slice is configured once - writePwm only sets the level
+            configurePwm();
+            pwm_set_enabled(pwm_gpio_to_slice_num(_pin), true);
+#endif
         }
 
         /*
@@ -42,9 +62,157 @@ namespace OpenKNX
                 digitalWrite(_pin, _activeOn == HIGH ? false : true);
 
             else
+#ifdef OPENKNX_LED_HWPWM_RP2040
+                writePwm(calcBrightness);
+#else
                 analogWrite(_pin, _activeOn == HIGH ? calcBrightness : (255 - calcBrightness));
+#endif
 
             _currentLedBrightness = calcBrightness;
         }
+
+#ifdef OPENKNX_LED_HWPWM_RP2040
+        /*
+         * @return true if another pin of the pwm slice is used as pwm output
+         */
+        bool GPIO::pwmShared()
+        {
+            const uint slice = pwm_gpio_to_slice_num(_pin);
+            for (uint gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+                if (gpio != (uint)_pin && pwm_gpio_to_slice_num(gpio) == slice && gpio_get_function(gpio) == GPIO_FUNC_PWM)
+                    return true;
+
+            return false;
+        }
+
+        /*
+         * Configure the pwm slice for OPENKNX_LED_HWPWM_FREQ. A slice shared with another pwm output keeps its configuration.
+         * Only called in loop context (init, startEffect) - not for each dimmed value.
+         */
+        void GPIO::configurePwm()
+        {
+            const uint slice = pwm_gpio_to_slice_num(_pin);
+            if (pwmShared())
+            {
+                _pwmTop = pwm_hw->slice[slice].top;
+                return;
+            }
+
+            const uint32_t cycles = clock_get_hz(clk_sys) / OPENKNX_LED_HWPWM_FREQ;
+            const uint32_t divider = MIN(cycles / 65536 + 1, 255);
+            _pwmTop = MIN(cycles / divider, 65536) - 1;
+
+            pwm_config config = pwm_get_default_config();
+            pwm_config_set_clkdiv_int(&config, divider);
+            pwm_config_set_wrap(&config, _pwmTop);
+            pwm_init(slice, &config, false);
+        }
+
+        uint16_t GPIO::pwmLevel(uint8_t brightness)
+        {
+            const uint16_t level = (uint32_t)brightness * (_pwmTop + 1) / 255;
+            return _activeOn == HIGH ? level : (_pwmTop + 1 - level);
+        }
+
+        /*
+         * Dimmed static value - uses the slice directly instead of analogWrite, because the slice is also used by the effects.
+         * The slice is already configured and enabled (init), so only the level is written.
+         */
+        void GPIO::writePwm(uint8_t brightness)
+        {
+            pwm_set_gpio_level(_pin, pwmLevel(brightness));
+            gpio_set_function(_pin, GPIO_FUNC_PWM);
+        }
+
+        bool GPIO::startEffect(Led::Effects::Base *effect)
+        {
+            // the dma writes the whole compare register - the effect is done by software on a shared slice
+            if (_pin < 0 || pwmShared())
+                return false;
+
+            // aligned for the read ring of the dma
+            if (_dutyTable == nullptr)
+            {
+                _dutyTable = (uint16_t *)aligned_alloc(OPENKNX_LED_HWPWM_STEPS * 2, OPENKNX_LED_HWPWM_STEPS * 2);
+                if (_dutyTable == nullptr)
+                    return false;
+            }
+
+            // one dma timer for all leds
+            if (_dmaTimer < 0)
+            {
+                _dmaTimer = dma_claim_unused_timer(false);
+                if (_dmaTimer < 0)
+                    return false;
+
+                dma_timer_set_fraction(_dmaTimer, 1, clock_get_hz(clk_sys) / OPENKNX_LED_HWPWM_PACE);
+            }
+
+            // the channels are only claimed while the effect is running - without free channels the effect is done by software
+            _dmaData = dma_claim_unused_channel(false);
+            _dmaDelay = dma_claim_unused_channel(false);
+            if (_dmaData < 0 || _dmaDelay < 0)
+            {
+                releaseDma();
+                return false;
+            }
+
+            configurePwm();
+            const uint32_t period = effect->period();
+            for (uint16_t i = 0; i < OPENKNX_LED_HWPWM_STEPS; i++)
+                _dutyTable[i] = pwmLevel((uint32_t)effect->valueAt((uint32_t)i * period / OPENKNX_LED_HWPWM_STEPS) * _maxBrightness / 100);
+
+            // timer ticks per step
+            const uint32_t ticks = MAX(1, (uint64_t)period * OPENKNX_LED_HWPWM_PACE / (1000 * OPENKNX_LED_HWPWM_STEPS));
+            const uint slice = pwm_gpio_to_slice_num(_pin);
+
+            // one value per trigger, the read ring rewinds the table
+            dma_channel_config data = dma_channel_get_default_config(_dmaData);
+            channel_config_set_transfer_data_size(&data, DMA_SIZE_16);
+            channel_config_set_read_increment(&data, true);
+            channel_config_set_write_increment(&data, false);
+            channel_config_set_ring(&data, false, __builtin_ctz(OPENKNX_LED_HWPWM_STEPS * 2));
+            channel_config_set_chain_to(&data, _dmaDelay);
+            dma_channel_configure(_dmaData, &data, &pwm_hw->slice[slice].cc, _dutyTable, 1, false);
+
+            // waits one step (dummy transfers paced by the timer) and triggers the data channel
+            dma_channel_config delay = dma_channel_get_default_config(_dmaDelay);
+            channel_config_set_transfer_data_size(&delay, DMA_SIZE_32);
+            channel_config_set_read_increment(&delay, false);
+            channel_config_set_write_increment(&delay, false);
+            channel_config_set_dreq(&delay, dma_get_timer_dreq(_dmaTimer));
+            channel_config_set_chain_to(&delay, _dmaData);
+            dma_channel_configure(_dmaDelay, &delay, &_dmaDummy, &_dmaDummy, ticks, false);
+
+            pwm_set_gpio_level(_pin, _dutyTable[0]);
+            gpio_set_function(_pin, GPIO_FUNC_PWM);
+            pwm_set_enabled(slice, true);
+            dma_channel_start(_dmaData);
+            return true;
+        }
+
+        void GPIO::releaseDma()
+        {
+            if (_dmaData >= 0) dma_channel_unclaim(_dmaData);
+            if (_dmaDelay >= 0) dma_channel_unclaim(_dmaDelay);
+            _dmaData = -1;
+            _dmaDelay = -1;
+        }
+
+        void GPIO::stopEffect()
+        {
+            // pause both channels first, otherwise they trigger each other again
+            hw_clear_bits(&dma_hw->ch[_dmaData].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+            hw_clear_bits(&dma_hw->ch[_dmaDelay].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+            dma_channel_abort(_dmaDelay);
+            dma_channel_abort(_dmaData);
+            releaseDma();
+
+            // back to a defined off state for writeLed
+            pinMode(_pin, OUTPUT);
+            digitalWrite(_pin, _activeOn == HIGH ? false : true);
+            _currentLedBrightness = 0;
+        }
+#endif
     } // namespace Led
 } // namespace OpenKNX
\ No newline at end of file
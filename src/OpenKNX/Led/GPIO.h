@@ -1,6 +1,23 @@
 #pragma once
 #include "OpenKNX/Led/Base.h"
 
+#if defined(OPENKNX_LED_HWPWM) && defined(ARDUINO_ARCH_RP2040)
+    #define OPENKNX_LED_HWPWM_RP2040
+
+    // number of values per period of an effect replayed by dma (power of two)
+    #ifndef OPENKNX_LED_HWPWM_STEPS
+        #define OPENKNX_LED_HWPWM_STEPS 256
+    #endif
+
+    // pwm frequency of the leds (dimmed static values and effects)
+    #ifndef OPENKNX_LED_HWPWM_FREQ
+        #define OPENKNX_LED_HWPWM_FREQ 1000
+    #endif
+
+    // rate of the dma timer in Hz, which paces the steps of the effects
+    #define OPENKNX_LED_HWPWM_PACE 10000
+#endif
+
 namespace OpenKNX
 {
     namespace Led
@@ -10,8 +27,35 @@ namespace OpenKNX
           private:
             void writeLed(uint8_t brightness) override;
 
+#ifdef OPENKNX_LED_HWPWM_RP2040
+            /*
+             * Periodic effects are rendered into a duty table, which a dma channel writes step by step into the compare
+             * register of the pwm slice (the read ring rewinds the table). The slice runs at OPENKNX_LED_HWPWM_FREQ.
+             * The steps are paced by a second dma channel, which waits the duration of one step on the (shared) dma timer
+             * and triggers the data channel again. The cpu only touches the led if the effect changes.
+             * The dma channels are claimed by startEffect and released by stopEffect (both loop context).
+             * The duty table is allocated on the first effect, so leds without effects need no memory for it.
+             * Hint: The compare register is written 16 bit (both channels), so an effect needs the slice alone.
+             */
+            int _dmaData = -1;
+            int _dmaDelay = -1;
+            uint16_t _pwmTop = 0;
+            uint16_t *_dutyTable = nullptr;
+
+            static int _dmaTimer;
+            static uint32_t _dmaDummy;
+
+            bool pwmShared();
+            void configurePwm();
+            uint16_t pwmLevel(uint8_t brightness);
+            void writePwm(uint8_t brightness);
+            void releaseDma();
+            bool startEffect(Led::Effects::Base *effect) override;
+            void stopEffect() override;
+#endif
+
           public:
             void init(long pin = -1, long activeOn = HIGH);
         };
     } // namespace Led
-} // namespace OpenKNX
\ No newline at end of file
+} // namespace OpenKNX
@@ -1,12 +1,18 @@
-#ifdef ARDUINO_ARCH_ESP32
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_RP2040)
     #include "OpenKNX/Led/Serial.h"
     #include "OpenKNX/Facade.h"
 
-    #include "esp_log.h"
-    #include "esp_system.h"
-    #include "freertos/FreeRTOS.h"
-    #include "freertos/task.h"
-    #include "freertos/timers.h"
+    #ifdef ARDUINO_ARCH_ESP32
+        #include "esp_log.h"
+        #include "esp_system.h"
+        #include "freertos/FreeRTOS.h"
+        #include "freertos/task.h"
+        #include "freertos/timers.h"
+    #else
+        #include "hardware/clocks.h"
+        #include "hardware/dma.h"
+        #include "hardware/pio.h"
+    #endif
 
 namespace OpenKNX
 {
@@ -43,16 +49,6 @@ namespace OpenKNX
             }
         }
 
-    #define BITS_PER_LED_CMD 24
-
-    // WS2812 timing parameters
-    // 0.35us and 0.90us
-    // on tick is 80MHz / divider = 0.025us
-    #define T0H 14 // 0 bit high time
-    #define T0L 36 // 0 bit low time
-    #define T1H 36 // 1 bit high time
-    #define T1L 14 // 1 bit low time
-
         /*
          * Set the color of the RGB LED
          */
@@ -64,25 +60,72 @@ namespace OpenKNX
             _manager->setLED(_pin, (color[0] * (uint16_t)_currentLedBrightness) / 256, (color[1] * (uint16_t)_currentLedBrightness) / 256, (color[2] * (uint16_t)_currentLedBrightness) / 256);
         }
 
-        void SerialLedManager::init(uint8_t ledPin, uint8_t rmtChannel, uint8_t ledCount)
+        bool SerialLedManager::pending()
+        {
+            return _dirty;
+        }
+
+    #ifdef ARDUINO_ARCH_ESP32
+    // WS2812 timing parameters
+    // 0.35us and 0.90us
+    // on tick is 80MHz / divider = 0.025us
+        #define T0H 14 // 0 bit high time
+        #define T0L 36 // 0 bit low time
+        #define T1H 36 // 1 bit high time
+        #define T1L 14 // 1 bit low time
+
+        /*
+         * Translator of the RMT driver: encodes the bytes of the frame on the fly into rmt items (called from the rmt interrupt)
+         */
+        static void IRAM_ATTR serialLedTranslator(const void *src, rmt_item32_t *dest, size_t srcSize, size_t wantedNum, size_t *translatedSize, size_t *itemNum)
+        {
+            if (src == nullptr || dest == nullptr)
+            {
+                *translatedSize = 0;
+                *itemNum = 0;
+                return;
+            }
+
+            rmt_item32_t bit0 = {};
+            bit0.level0 = 1;
+            bit0.duration0 = T0H;
+            bit0.level1 = 0;
+            bit0.duration1 = T0L;
+            rmt_item32_t bit1 = {};
+            bit1.level0 = 1;
+            bit1.duration0 = T1H;
+            bit1.level1 = 0;
+            bit1.duration1 = T1L;
+
+            const uint8_t *data = (const uint8_t *)src;
+            size_t size = 0;
+            size_t num = 0;
+            while (size < srcSize && num + 8 <= wantedNum)
+            {
+                for (uint8_t i = 0; i < 8; i++)
+                {
+                    dest->val = (data[size] & (1 << (7 - i))) ? bit1.val : bit0.val;
+                    dest++;
+                    num++;
+                }
+                size++;
+            }
+            *translatedSize = size;
+            *itemNum = num;
+        }
+
+        void SerialLedManager::init(uint8_t ledPin, uint8_t rmtChannel, uint16_t ledCount)
         {
             _rmtChannel = rmtChannel;
             _ledCount = ledCount;
             rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)ledPin, (rmt_channel_t)rmtChannel);
             config.clk_div = 2;
-            config.mem_block_num = ((ledCount * BITS_PER_LED_CMD) / 64) + 1; // one memblock has 64 * 32-bit values (rmt items) which represent 1 encoded bit for ws2812 led. 24bit per LED
-
-            _rmtItems = new rmt_item32_t[_ledCount * BITS_PER_LED_CMD + 1];
-            _ledData = new uint32_t[_ledCount];
+            // one memblock is enough, because the translator refills it during the transmission
 
             // initalize with all LEDs off
-            for (int i = 0; i < BITS_PER_LED_CMD * _ledCount; i++)
-            {
-                _rmtItems[i].level0 = 1;
-                _rmtItems[i].duration0 = T0H;
-                _rmtItems[i].level1 = 0;
-                _rmtItems[i].duration1 = T1H;
-            }
+            _ledData = new uint8_t[_ledCount * 3]();
+            _frame = new uint8_t[_ledCount * 3]();
+            _dirty = true;
 
             // Initialize the RMT driver
             if (rmt_config(&config) != ESP_OK)
@@ -95,6 +138,11 @@ namespace OpenKNX
                 logError("SerialLedManager", "Installation of RMT driver failed");
                 return;
             }
+            if (rmt_translator_init(config.channel, serialLedTranslator) != ESP_OK)
+            {
+                logError("SerialLedManager", "Installation of RMT translator failed");
+                return;
+            }
 
             writeLeds();
 
@@ -106,18 +154,16 @@ namespace OpenKNX
                 (void *)0,          // Timer-ID (kann für Identifikation verwendet werden)
                 [](TimerHandle_t timer) {
                     openknx.progLed.loop();
-    #ifdef INFO2_LED_PIN
+        #ifdef INFO2_LED_PIN
                     openknx.info2Led.loop();
-    #endif
-    #ifdef INFO1_LED_PIN
+        #endif
+        #ifdef INFO1_LED_PIN
                     openknx.info1Led.loop();
-    #endif
-    #ifdef INFO3_LED_PIN
+        #endif
+        #ifdef INFO3_LED_PIN
                     openknx.info3Led.loop();
-    #endif
-    #ifdef OPENKNX_SERIALLED_ENABLE
+        #endif
                     openknx.ledManager.writeLeds();
-    #endif
                 } // Callback-Funktion, die beim Timeout aufgerufen wird
             );
 
@@ -136,63 +182,122 @@ namespace OpenKNX
             }
         }
 
-        void SerialLedManager::setLED(uint8_t ledAdr, uint8_t r, uint8_t g, uint8_t b)
+        void SerialLedManager::setLED(uint16_t ledAdr, uint8_t r, uint8_t g, uint8_t b)
         {
-            uint32_t newrgb = (g << 16) | (r << 8) | b;
-            if (_ledData[ledAdr] != newrgb)
+            if (ledAdr >= _ledCount)
+                return;
+
+            uint8_t *data = _ledData + ledAdr * 3;
+            if (data[0] != g || data[1] != r || data[2] != b)
             {
-                _ledData[ledAdr] = newrgb;
-                _dirty |= (1 << ledAdr);
+                data[0] = g;
+                data[1] = r;
+                data[2] = b;
+                _dirty = true;
             }
         }
 
-        void SerialLedManager::fillRmt()
+        void SerialLedManager::writeLeds()
+        {
+            // prevent calling a new rmt transmission into an running one (the frame buffer is in use)
+            if (!_dirty || rmt_wait_tx_done((rmt_channel_t)_rmtChannel, 0) != ESP_OK)
+                return;
+
+            // reset before the copy, so a concurrent change is sent with the next frame
+            _dirty = false;
+            memcpy(_frame, _ledData, _ledCount * 3);
+            rmt_write_sample((rmt_channel_t)_rmtChannel, _frame, _ledCount * 3, false);
+        }
+    #else
+        // ws2812 program of the pico-examples: 10 cycles per bit (800kHz) with side-set on the led pin
+        static const uint16_t serialLedInstructions[] = {
+            0x6221, //  0: out    x, 1            side 0 [2]
+            0x1123, //  1: jmp    !x, 3           side 1 [1]
+            0x1400, //  2: jmp    0               side 1 [4]
+            0xa442, //  3: nop                    side 0 [4]
+        };
+        static const pio_program serialLedProgram = {serialLedInstructions, 4, -1};
+
+        void SerialLedManager::init(uint8_t ledPin, uint8_t rmtChannel, uint16_t ledCount)
         {
-            for (int j = 0; j < _ledCount; j++)
+            _ledCount = ledCount;
+            // 30us per led and the reset time
+            _frameTime = _ledCount * 30 + 300;
+
+            // initalize with all LEDs off
+            _ledData = new uint32_t[_ledCount]();
+            _frame = new uint32_t[_ledCount]();
+            _dirty = true;
+
+            PIO pio = pio0;
+            if (!pio_can_add_program(pio, &serialLedProgram))
+                pio = pio1;
+
+            const int sm = pio_claim_unused_sm(pio, false);
+            if (sm < 0 || !pio_can_add_program(pio, &serialLedProgram))
             {
-                if (_dirty & (1 << j))
-                {
-                    uint32_t colorbits = _ledData[j];
-                    for (int i = 0; i < BITS_PER_LED_CMD; i++)
-                    {
-                        if (colorbits & (1 << (23 - i)))
-                        {
-                            _rmtItems[j * BITS_PER_LED_CMD + i].duration0 = T0L;
-                            _rmtItems[j * BITS_PER_LED_CMD + i].duration1 = T1L;
-                        }
-                        else
-                        {
-                            _rmtItems[j * BITS_PER_LED_CMD + i].duration0 = T0H;
-                            _rmtItems[j * BITS_PER_LED_CMD + i].duration1 = T1H;
-                        }
-                    }
-                }
+                logError("SerialLedManager", "No free PIO state machine");
+                return;
             }
+
+            const uint offset = pio_add_program(pio, &serialLedProgram);
+            pio_gpio_init(pio, ledPin);
+            pio_sm_set_consistent_pindirs(pio, sm, ledPin, 1, true);
+
+            pio_sm_config config = pio_get_default_sm_config();
+            sm_config_set_wrap(&config, offset, offset + 3);
+            sm_config_set_sideset(&config, 1, false, false);
+            sm_config_set_sideset_pins(&config, ledPin);
+            sm_config_set_out_shift(&config, false, true, 24);
+            sm_config_set_fifo_join(&config, PIO_FIFO_JOIN_TX);
+            sm_config_set_clkdiv(&config, (float)clock_get_hz(clk_sys) / (800000 * 10));
+            pio_sm_init(pio, sm, offset, &config);
+            pio_sm_set_enabled(pio, sm, true);
+
+            _dmaChannel = dma_claim_unused_channel(false);
+            if (_dmaChannel < 0)
+            {
+                logError("SerialLedManager", "No free DMA channel");
+                return;
+            }
+
+            dma_channel_config dma = dma_channel_get_default_config(_dmaChannel);
+            channel_config_set_transfer_data_size(&dma, DMA_SIZE_32);
+            channel_config_set_read_increment(&dma, true);
+            channel_config_set_write_increment(&dma, false);
+            channel_config_set_dreq(&dma, pio_get_dreq(pio, sm, true));
+            dma_channel_configure(_dmaChannel, &dma, &pio->txf[sm], _frame, _ledCount, false);
+
+            writeLeds();
         }
 
-        void SerialLedManager::writeLeds()
+        void SerialLedManager::setLED(uint16_t ledAdr, uint8_t r, uint8_t g, uint8_t b)
         {
-            if (!_dirty)
+            if (ledAdr >= _ledCount)
                 return;
 
-            if (delayCheckMillis(_lastWritten, 5)) // prevent calling a new rmt transmission into an running on
+            const uint32_t data = ((uint32_t)g << 24) | ((uint32_t)r << 16) | ((uint32_t)b << 8);
+            if (_ledData[ledAdr] != data)
             {
-                _lastWritten = millis();
-                // uint32_t t1 = micros();
-                fillRmt();
-                // uint32_t t2 = micros();
-                rmt_write_items((rmt_channel_t)_rmtChannel, _rmtItems, _ledCount * BITS_PER_LED_CMD, false);
-                _dirty = 0;
-                // uint32_t t3 = micros();
-
-                //::Serial.print("fillRmt: ");
-                //::Serial.print(t2-t1);
-                //::Serial.print("us. rmt write: ");
-                //::Serial.print(t3-t2);
-                //::Serial.println("us");
+                _ledData[ledAdr] = data;
+                _dirty = true;
             }
         }
+
+        void SerialLedManager::writeLeds()
+        {
+            // the previous frame (incl. reset time) must be finished, because the frame buffer is in use
+            if (!_dirty || _dmaChannel < 0 || dma_channel_is_busy(_dmaChannel) || !delayCheckMicros(_lastWritten, _frameTime))
+                return;
+
+            // reset before the copy, so a concurrent change is sent with the next frame
+            _dirty = false;
+            memcpy(_frame, _ledData, _ledCount * sizeof(uint32_t));
+            _lastWritten = micros();
+            dma_channel_set_read_addr(_dmaChannel, _frame, true);
+        }
+    #endif
     } // namespace Led
 } // namespace OpenKNX
 
-#endif
\ No newline at end of file
+#endif
@@ -1,29 +1,47 @@
 #pragma once
-#ifdef ARDUINO_ARCH_ESP32
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_RP2040)
     #include "OpenKNX/Led/Base.h"
-    #include <driver/rmt.h>
+    #ifdef ARDUINO_ARCH_ESP32
+        #include <driver/rmt.h>
+    #endif
 
 namespace OpenKNX
 {
     namespace Led
     {
-
+        /*
+         * Drives a strip of WS2812 LEDs.
+         * The LEDs write into a back buffer. writeLeds copies it into the frame buffer for the transmission,
+         * if something is changed and the previous frame is finished.
+         * ESP32: RMT, the bits are encoded on the fly by a translator (no rmt item per bit in memory)
+         * RP2040: PIO state machine fed by DMA
+         */
         class SerialLedManager
         {
           private:
-            rmt_item32_t *_rmtItems = nullptr;
+            uint16_t _ledCount = 0;
+            volatile bool _dirty = false;
+    #ifdef ARDUINO_ARCH_ESP32
             uint8_t _rmtChannel = 0;
-            uint8_t _ledCount = 0;
-            uint32_t _lastWritten = 0;
-            uint32_t *_ledData = nullptr;
-            uint32_t _dirty = 0;
+            uint8_t *_ledData = nullptr; // GRB
+            uint8_t *_frame = nullptr;
             TimerHandle_t _timer;
-            void fillRmt();
+    #else
+            int _dmaChannel = -1;
+            uint32_t _lastWritten = 0;
+            uint32_t _frameTime = 0;
+            uint32_t *_ledData = nullptr; // GRB left aligned
+            uint32_t *_frame = nullptr;
+    #endif
 
           public:
-            void init(uint8_t ledPin, uint8_t rmtChannel, uint8_t ledCount);
-            void setLED(uint8_t ledAdr, uint8_t r, uint8_t g, uint8_t b);
+            /*
+             * @param rmtChannel only used on ESP32
+             */
+            void init(uint8_t ledPin, uint8_t rmtChannel, uint16_t ledCount);
+            void setLED(uint16_t ledAdr, uint8_t r, uint8_t g, uint8_t b);
             void writeLeds(); // send the color data to the LEDs
+            bool pending();   // changes are not sent yet
         };
 
         class Serial : public Base
@@ -39,6 +39,18 @@ namespace OpenKNX
 #endif
         }
 
+        Print* Logger::capture(Print* sink)
+        {
+            Print* previous = STATE_BY_CORE(_capture);
+            STATE_BY_CORE(_capture) = sink;
+            return previous;
+        }
+
+        Print* Logger::captured()
+        {
+            return STATE_BY_CORE(_capture);
+        }
+
         void Logger::color(uint8_t color)
         {
             STATE_BY_CORE(_color) = color;
@@ -83,6 +95,9 @@ namespace OpenKNX
             if (isColorSet())
                 printColorCode(0);
             OPENKNX_LOGGER_DEVICE.println();
+            Print* capture = STATE_BY_CORE(_capture);
+            if (capture)
+                capture->println();
             printPrompt();
             end();
         }
@@ -94,6 +109,7 @@ namespace OpenKNX
 
         void Logger::log(const char* message)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printMessage(message);
             afterLog();
@@ -106,6 +122,7 @@ namespace OpenKNX
 
         void Logger::logWithPrefix(const char* prefix, const char* message)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printPrefix(prefix);
             printIndent();
@@ -131,6 +148,7 @@ namespace OpenKNX
 
         void Logger::logWithPrefixAndValues(const char* prefix, const char* message, va_list& values)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printPrefix(prefix);
             printIndent();
@@ -156,6 +174,7 @@ namespace OpenKNX
 
         void Logger::logWithValues(const char* message, va_list& values)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printMessage(message, values);
             afterLog();
@@ -163,6 +182,7 @@ namespace OpenKNX
 
         void Logger::logHex(const uint8_t* data, size_t size)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printHex(data, size);
             afterLog();
@@ -175,6 +195,7 @@ namespace OpenKNX
 
         void Logger::logHexWithPrefix(const char* prefix, const uint8_t* data, size_t size)
         {
+            HEAPTRACK_SCOPE(Stat::HeapOwnerLogger);
             beforeLog();
             printPrefix(prefix);
             printIndent();
@@ -261,6 +282,19 @@ namespace OpenKNX
                 OPENKNX_LOGGER_DEVICE.print(data[i], HEX);
                 OPENKNX_LOGGER_DEVICE.print(" ");
             }
+
+            Print* capture = STATE_BY_CORE(_capture);
+            if (capture)
+            {
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (data[i] < 0x10)
+                        capture->print("0");
+
+                    capture->print(data[i], HEX);
+                    capture->print(" ");
+                }
+            }
         }
 
         void Logger::clearPreviouseLine()
@@ -297,6 +331,14 @@ namespace OpenKNX
                     OPENKNX_LOGGER_DEVICE.print(" ");
                 }
             }
+
+            // without padding
+            Print* capture = STATE_BY_CORE(_capture);
+            if (capture && prefixLen > 0)
+            {
+                capture->write((const uint8_t*)prefix, prefixLen);
+                capture->print(": ");
+            }
         }
 
         void Logger::printCore()
@@ -316,6 +358,9 @@ namespace OpenKNX
         void Logger::printMessage(const char* message)
         {
             OPENKNX_LOGGER_DEVICE.print(message);
+            Print* capture = STATE_BY_CORE(_capture);
+            if (capture)
+                capture->print(message);
         }
 
         void Logger::printMessage(const char* message, va_list& values)
@@ -323,13 +368,13 @@ namespace OpenKNX
             const char* found = strchr(message, '%');
             if (found == NULL)
             {
-                OPENKNX_LOGGER_DEVICE.print(message);
+                printMessage(message);
                 return;
             }
 
             memset(_buffer, 0, OPENKNX_MAX_LOG_MESSAGE_LENGTH);
             uint16_t len = vsnprintf(_buffer, OPENKNX_MAX_LOG_MESSAGE_LENGTH, message, values);
-            OPENKNX_LOGGER_DEVICE.print(_buffer);
+            printMessage(_buffer);
             if (len >= OPENKNX_MAX_LOG_MESSAGE_LENGTH)
                 openknx.hardware.fatalError(FATAL_SYSTEM, "BufferOverflow: increase OPENKNX_MAX_LOG_MESSAGE_LENGTH");
         }
@@ -366,8 +411,13 @@ namespace OpenKNX
 
         void Logger::printIndent()
         {
+            Print* capture = STATE_BY_CORE(_capture);
             for (size_t i = 0; i < getIndent(); i++)
+            {
                 OPENKNX_LOGGER_DEVICE.print("  ");
+                if (capture)
+                    capture->print("  ");
+            }
         }
 
         void Logger::indentUp()
@@ -122,10 +122,13 @@ namespace OpenKNX
             // use individual values per core
             volatile uint8_t _color[2] = {(uint8_t)0, (uint8_t)0};
             volatile uint8_t _indent[2] = {(uint8_t)0, (uint8_t)0};
+            // only the output of the capturing core is copied
+            Print* _capture[2] = {nullptr, nullptr};
             recursive_mutex_t _mutex;
 #else
             uint8_t _color = 0;
             uint8_t _indent = 0;
+            Print* _capture = nullptr;
 #endif
             void printHex(const uint8_t* data, size_t size);
             void printMessage(const char* message, va_list& values);
@@ -206,6 +209,17 @@ namespace OpenKNX
 #if defined(OPENKNX_TRACE1) || defined(OPENKNX_TRACE2) || defined(OPENKNX_TRACE3) || defined(OPENKNX_TRACE4) || defined(OPENKNX_TRACE5)
             bool checkTrace(const std::string& prefix);
 #endif
+            /*
+             * Copy the messages (without timestamp and colors) additionally to sink, e.g. to send the output of
+             * a command on the bus. nullptr ends the capturing. Only the output of the calling core is captured.
+             * @return the previous sink, which should be restored after capturing
+             */
+            Print* capture(Print* sink);
+            /*
+             * @return the current sink of the calling core or nullptr
+             */
+            Print* captured();
+
             void printPrompt();
             void clearPreviouseLine();
             void logOpenKnxHeader();
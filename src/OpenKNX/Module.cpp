@@ -12,8 +12,21 @@ namespace OpenKNX
 
     void Module::readFlash(const uint8_t *data, const uint16_t size) {}
 
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+    InputKoDispatch Module::inputKoDispatch()
+    {
+        return InputKoDispatch::Direct;
+    }
+#endif
+
     void Module::processAfterStartupDelay() {}
 
+    bool Module::processAfterStartupDelayStep(uint16_t step)
+    {
+        processAfterStartupDelay();
+        return false;
+    }
+
     void Module::processBeforeRestart() {}
 
     void Module::processBeforeTablesUnload() {}
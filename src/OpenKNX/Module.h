@@ -3,6 +3,18 @@
 
 namespace OpenKNX
 {
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+    /*
+     * How incoming GroupObjects are delivered to processInputKo of a module
+     */
+    enum class InputKoDispatch : uint8_t
+    {
+        Direct, // synchronous inside knx.loop() on core0 (default)
+        Loop,   // queued and delivered before loop() on core0
+        Loop1,  // queued and delivered before loop1() on core1 (Loop without dual-core)
+    };
+#endif
+
     /*
      * Abstract class for Modules
      */
@@ -40,11 +52,39 @@ namespace OpenKNX
          */
         virtual void readFlash(const uint8_t *data, const uint16_t size);
 
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+        /*
+         * Defines on which core and when processInputKo of this module is called.
+         * With Loop/Loop1 the incoming GroupObjects are only queued inside knx.loop() (requires OPENKNX_KO_QUEUE)
+         * and delivered in a batch before the next loop()/loop1() of the module.
+         *
+         * Hint: The GroupObject is delivered by reference, so a queued event will see the current value of the GroupObject.
+         * If the queue of the module is full, the event will be dropped (see console command "koqueue").
+         *
+         * @return dispatch mode
+         */
+        virtual InputKoDispatch inputKoDispatch();
+#endif
+
         /*
          * Called after the startup delay time are expired.
+         * Hint: Initial values should be sent with openknx.transmit.send(...) to avoid a burst on the bus.
          */
         virtual void processAfterStartupDelay();
 
+        /*
+         * Called stepwise after the startup delay time are expired. The modules are processed one after another
+         * with OPENKNX_STARTUP_STEP_INTERVAL (plus a jitter per device) between two steps. After OPENKNX_STARTUP_MAX_DURATION
+         * the remaining steps of all modules run one per loop. Until the first step of the module has run,
+         * openknx.afterStartupDelay() is false in its loop/loop1.
+         * Override it to split the startup work, e.g. one read request or channel per step.
+         * The default implementation calls processAfterStartupDelay() once.
+         *
+         * @param step starts with 0 and is incremented for each call
+         * @return true if more steps follow
+         */
+        virtual bool processAfterStartupDelayStep(uint16_t step);
+
         /*
          * Called before the device will restart.
          * This happen when you reset device by knx or the after ETS has parameterized the application
@@ -60,6 +100,7 @@ namespace OpenKNX
         /*
          * Called if knx receives an function property command and no Property is declared in stack.
          * Can be invoked by script in ETS
+         * Hint: Handlers registered with openknx.common.registerFunctionProperty (OPENKNX_FUNCTION_PROPERTIES) are preferred and faster.
          */
         virtual bool processFunctionProperty(uint8_t objectIndex, uint8_t propertyId, uint8_t length, uint8_t *data, uint8_t *resultData, uint8_t &resultLength);
         /*
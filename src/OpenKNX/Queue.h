@@ -0,0 +1,139 @@
+#pragma once
+#include "OpenKNX/SpinLock.h"
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <atomic>
+
+namespace OpenKNX
+{
+    /*
+     * Bounded lock-free queue for exactly one producer and one consumer (e.g. loop -> loop1 or ISR -> loop).
+     *
+     * The indices are free running counters which are only written by one side,
+     * so only atomic load/store is needed (no read-modify-write, which the Cortex-M0+ does not support).
+     * The size must be a power of two.
+     */
+    template <typename T, uint16_t N>
+    class SpscQueue
+    {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+      private:
+        T _items[N];
+        std::atomic<uint32_t> _head{0}; // written by producer only
+        std::atomic<uint32_t> _tail{0}; // written by consumer only
+
+      public:
+        /*
+         * Called by the producer only
+         * @return false if the queue is full
+         */
+        bool push(const T &item)
+        {
+            const uint32_t head = _head.load(std::memory_order_relaxed);
+            if (head - _tail.load(std::memory_order_acquire) >= N) return false;
+
+            _items[head % N] = item;
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*
+         * Called by the consumer only
+         * @return false if the queue is empty
+         */
+        bool pop(T &item)
+        {
+            const uint32_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail == _head.load(std::memory_order_acquire)) return false;
+
+            item = _items[tail % N];
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*
+         * Called by the consumer only
+         * @return false if the queue is empty
+         */
+        bool peek(T &item)
+        {
+            const uint32_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail == _head.load(std::memory_order_acquire)) return false;
+
+            item = _items[tail % N];
+            return true;
+        }
+
+        bool empty()
+        {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+        uint16_t size()
+        {
+            return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+        }
+
+        static constexpr uint16_t capacity()
+        {
+            return N;
+        }
+    };
+
+    /*
+     * Bounded queue for multiple producers (both cores and interrupts) and one consumer.
+     *
+     * The producers are serialized by a SpinLock (held only for copying the item),
+     * the consumer works lock-free like SpscQueue.
+     */
+    template <typename T, uint16_t N>
+    class MpscQueue
+    {
+      private:
+        SpscQueue<T, N> _queue;
+        SpinLock _lock;
+
+      public:
+        /*
+         * Can be called from any core or interrupt
+         * @return false if the queue is full
+         */
+        bool push(const T &item)
+        {
+            const uint32_t state = _lock.lock();
+            const bool added = _queue.push(item);
+            _lock.unlock(state);
+            return added;
+        }
+
+        /*
+         * Called by the consumer only
+         * @return false if the queue is empty
+         */
+        bool pop(T &item)
+        {
+            return _queue.pop(item);
+        }
+
+        bool peek(T &item)
+        {
+            return _queue.peek(item);
+        }
+
+        bool empty()
+        {
+            return _queue.empty();
+        }
+
+        uint16_t size()
+        {
+            return _queue.size();
+        }
+
+        static constexpr uint16_t capacity()
+        {
+            return N;
+        }
+    };
+} // namespace OpenKNX
@@ -0,0 +1,76 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+    #include "hardware/sync.h"
+#endif
+
+namespace OpenKNX
+{
+    /*
+     * Short critical section which is safe against interrupts and the other core.
+     *
+     * RP2040: own hardware spinlock from the free range of the sdk (+ interrupts disabled on current core), so it is not
+     *         shared with the striped locks of the sdk mutexes. Other locks (e.g. the alarm pool) can be taken while held.
+     *         Only if all free spinlocks are already claimed, a striped lock is used as fallback - then the lock could be
+     *         shared with an sdk mutex and must not be nested.
+     * ESP32:  portMUX critical section
+     * SAMD:   interrupts disabled
+     *
+     * Attention: The lock is not recursive and must be held as short as possible (no logging, no flash access)!
+     * Nested SpinLocks must always be taken in the same order.
+     */
+    class SpinLock
+    {
+      private:
+#if defined(ARDUINO_ARCH_RP2040)
+        spin_lock_t *_lock = nullptr;
+#elif defined(ARDUINO_ARCH_ESP32)
+        portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+      public:
+        SpinLock()
+        {
+#ifdef ARDUINO_ARCH_RP2040
+            const int num = spin_lock_claim_unused(false);
+            _lock = spin_lock_instance(num >= 0 ? num : next_striped_spin_lock_num());
+#endif
+        }
+
+        /*
+         * Enter the critical section
+         * @return state to restore on unlock()
+         */
+        inline uint32_t lock()
+        {
+#if defined(ARDUINO_ARCH_RP2040)
+            return spin_lock_blocking(_lock);
+#elif defined(ARDUINO_ARCH_ESP32)
+            portENTER_CRITICAL_SAFE(&_mux);
+            return 0;
+#else
+            const uint32_t state = __get_PRIMASK();
+            __disable_irq();
+            return state;
+#endif
+        }
+
+        /*
+         * Leave the critical section
+         * @param state returned by lock()
+         */
+        inline void unlock(uint32_t state)
+        {
+#if defined(ARDUINO_ARCH_RP2040)
+            spin_unlock(_lock, state);
+#elif defined(ARDUINO_ARCH_ESP32)
+            (void)state;
+            portEXIT_CRITICAL_SAFE(&_mux);
+#else
+            __set_PRIMASK(state);
+#endif
+        }
+    };
+} // namespace OpenKNX
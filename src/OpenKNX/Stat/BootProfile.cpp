@@ -0,0 +1,210 @@
+#include "OpenKNX/Stat/BootProfile.h"
+
+#ifdef OPENKNX_BOOTPROFILE
+    #include "OpenKNX/Facade.h"
+
+    // changes with the layout, so an old timeline is not misinterpreted after a firmware update
+    #define OPENKNX_BOOTPROFILE_MAGIC (0xB0070000 | OPENKNX_BOOTPROFILE_SIZE)
+
+struct BootProfileStore
+{
+    uint32_t magic;
+    uint8_t current;
+    OpenKNX::Stat::BootProfileData boots[2];
+};
+
+    #if defined(ARDUINO_ARCH_RP2040)
+BootProfileStore __uninitialized_ram(__openKnxBootProfile);
+    #elif defined(ARDUINO_ARCH_ESP32)
+static RTC_NOINIT_ATTR BootProfileStore __openKnxBootProfile;
+    #else
+// Not supported - only the current boot
+BootProfileStore __openKnxBootProfile = {};
+    #endif
+
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        std::string BootProfile::logPrefix()
+        {
+            return "BootProfile";
+        }
+
+        BootProfileData &BootProfile::current()
+        {
+            return __openKnxBootProfile.boots[__openKnxBootProfile.current];
+        }
+
+        BootProfileData &BootProfile::previous()
+        {
+            return __openKnxBootProfile.boots[!__openKnxBootProfile.current];
+        }
+
+        void BootProfile::init()
+        {
+            BootProfileStore &store = __openKnxBootProfile;
+            if (store.magic == OPENKNX_BOOTPROFILE_MAGIC && store.current <= 1 && current().count <= OPENKNX_BOOTPROFILE_SIZE)
+            {
+                // warm restart - keep the last timeline
+                store.current = !store.current;
+                current().boot = previous().boot + 1;
+            }
+            else
+            {
+                // power up (random content)
+                memset(&store, 0, sizeof(store));
+                store.magic = OPENKNX_BOOTPROFILE_MAGIC;
+            }
+
+            current().count = 0;
+            _depth = 0;
+            _completed = false;
+        }
+
+        BootProfileRecord *BootProfile::add(uint16_t id, bool instant)
+        {
+            BootProfileData &data = current();
+            if (_completed || data.count >= OPENKNX_BOOTPROFILE_SIZE)
+                return nullptr;
+
+            BootProfileRecord &record = data.records[data.count++];
+            record.start = micros();
+            record.duration = 0;
+            record.id = id;
+            record.depth = _depth;
+            record.instant = instant;
+            return &record;
+        }
+
+        void BootProfile::begin(uint16_t id)
+        {
+            if (add(id, false) != nullptr)
+                _depth++;
+        }
+
+        void BootProfile::end(uint16_t id)
+        {
+            BootProfileData &data = current();
+            for (int16_t i = data.count - 1; i >= 0; i--)
+            {
+                BootProfileRecord &record = data.records[i];
+                if (record.id != id || record.instant)
+                    continue;
+
+                if (record.duration == 0)
+                {
+                    record.duration = micros() - record.start;
+                    _depth--;
+                }
+                return;
+            }
+        }
+
+        void BootProfile::instant(uint16_t id)
+        {
+            add(id, true);
+            // the timeline ends with the first telegram
+            if (id == BootFirstTelegram)
+                _completed = true;
+        }
+
+        const char *BootProfile::name(uint16_t id)
+        {
+            switch (id)
+            {
+                case BootInit:
+                    return "Init";
+                case BootTimers:
+                    return "Timers";
+                case BootLeds:
+                    return "Leds";
+                case BootRecovery:
+                    return "Recovery";
+                case BootButtons:
+                    return "Buttons";
+                case BootDebugWait:
+                    return "DebugWait";
+                case BootFlashInit:
+                    return "FlashInit";
+                case BootKnxInit:
+                    return "KnxInit";
+                case BootKnxReadMemory:
+                    return "KnxReadMemory";
+                case BootHardware:
+                    return "Hardware";
+                case BootSetup:
+                    return "Setup";
+                case BootFlashLoad:
+                    return "FlashLoad";
+                case BootKnxStart:
+                    return "KnxStart";
+                case BootSetup1Wait:
+                    return "Setup1Wait";
+                case BootStartupDelay:
+                    return "StartupDelay";
+                case BootStartupCompleted:
+                    return "StartupCompleted";
+                case BootFirstTelegram:
+                    return "FirstTelegram";
+            }
+            return nullptr;
+        }
+
+        void BootProfile::show(BootProfileData &data)
+        {
+            if (data.boot == 0)
+                logInfoP("Power up (%u of %u records)", data.count, OPENKNX_BOOTPROFILE_SIZE);
+            else
+                logInfoP("Warm restart %u (%u of %u records)", data.boot, data.count, OPENKNX_BOOTPROFILE_SIZE);
+            logInfoP("%10s  %10s  %s", "Start us", "Time us", "Phase");
+            for (uint16_t i = 0; i < data.count; i++)
+            {
+                const BootProfileRecord &record = data.records[i];
+                const char *framework = name(record.id);
+                std::string label = framework != nullptr ? framework : "Unknown";
+                if (framework == nullptr)
+                {
+                    const uint8_t index = record.id & 0xFF;
+                    Module *module = nullptr;
+                    if ((record.id & 0xFF00) == BootModuleReadFlash)
+                        module = openknx.getModule(index);
+                    else if (index < openknx.modules.count)
+                        module = openknx.modules.list[index];
+
+                    if (module != nullptr)
+                    {
+                        label = module->name();
+                        if ((record.id & 0xFF00) == BootModuleInit) label += " init";
+                        if ((record.id & 0xFF00) == BootModuleSetup) label += " setup";
+                        if ((record.id & 0xFF00) == BootModuleReadFlash) label += " readFlash";
+                    }
+                }
+
+                if (record.instant)
+                    logInfoP("%10u  %10s  %*s%s", record.start, "", record.depth * 2, "", label.c_str());
+                else if (record.duration == 0)
+                    logInfoP("%10u  %10s  %*s%s", record.start, "running", record.depth * 2, "", label.c_str());
+                else
+                    logInfoP("%10u  %10u  %*s%s", record.start, record.duration, record.depth * 2, "", label.c_str());
+            }
+        }
+
+        void BootProfile::showStatus()
+        {
+            show(current());
+        }
+
+        void BootProfile::showPrevious()
+        {
+            if (current().boot == 0)
+            {
+                logInfoP("No previous boot recorded (power up)");
+                return;
+            }
+
+            show(previous());
+        }
+    } // namespace Stat
+} // namespace OpenKNX
+#endif
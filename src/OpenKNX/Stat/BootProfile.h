@@ -0,0 +1,110 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+#ifndef OPENKNX_BOOTPROFILE_SIZE
+    #ifdef ARDUINO_ARCH_SAMD
+        #define OPENKNX_BOOTPROFILE_SIZE 32
+    #else
+        #define OPENKNX_BOOTPROFILE_SIZE 64
+    #endif
+#endif
+
+#ifdef OPENKNX_BOOTPROFILE
+    #define BOOTPROFILE_BEGIN(X) openknx.bootProfile.begin(X);
+    #define BOOTPROFILE_END(X) openknx.bootProfile.end(X);
+    #define BOOTPROFILE_INSTANT(X) openknx.bootProfile.instant(X);
+#else
+    #define BOOTPROFILE_BEGIN(X)
+    #define BOOTPROFILE_END(X)
+    #define BOOTPROFILE_INSTANT(X)
+#endif
+
+#ifdef OPENKNX_BOOTPROFILE
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        /*
+         * Phases of the startup.
+         * Modules are recorded with BootModuleInit/BootModuleSetup + index and BootModuleReadFlash + id.
+         */
+        enum BootProfileId : uint16_t
+        {
+            BootInit = 1,
+            BootTimers,
+            BootLeds,
+            BootRecovery,
+            BootButtons,
+            BootDebugWait,
+            BootFlashInit,
+            BootKnxInit,
+            BootKnxReadMemory,
+            BootHardware,
+            BootSetup,
+            BootFlashLoad,
+            BootKnxStart,
+            BootSetup1Wait,
+            BootStartupDelay,
+            BootStartupCompleted,
+            BootFirstTelegram,
+            BootModuleInit = 0x100,
+            BootModuleSetup = 0x200,
+            BootModuleReadFlash = 0x300,
+        };
+
+        /*
+         * One phase (12 bytes), instants have no duration
+         */
+        struct BootProfileRecord
+        {
+            uint32_t start;
+            uint32_t duration;
+            uint16_t id;
+            uint8_t depth;
+            uint8_t instant;
+        };
+
+        struct BootProfileData
+        {
+            uint16_t boot; // warm restarts since the last power up
+            uint16_t count;
+            BootProfileRecord records[OPENKNX_BOOTPROFILE_SIZE];
+        };
+
+        /*
+         * Timeline of the startup from reset to the first telegram with us timestamps (since reset).
+         *
+         * The records are kept in no-init ram (RP2040, ESP32), so the timeline of the previous boot
+         * survives a warm restart (e.g. by the watchdog) and can be compared with the current one.
+         */
+        class BootProfile
+        {
+          private:
+            uint8_t _depth = 0;
+            bool _completed = false;
+
+            BootProfileData &current();
+            BootProfileData &previous();
+            BootProfileRecord *add(uint16_t id, bool instant);
+            static const char *name(uint16_t id);
+            void show(BootProfileData &data);
+
+          public:
+            /*
+             * Start a new timeline (called first in Common::init)
+             */
+            void init();
+
+            void begin(uint16_t id);
+            void end(uint16_t id);
+            void instant(uint16_t id);
+
+            void showStatus();
+            void showPrevious();
+            std::string logPrefix();
+        };
+    } // namespace Stat
+} // namespace OpenKNX
+#endif
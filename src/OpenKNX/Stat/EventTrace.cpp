@@ -0,0 +1,155 @@
+#include "OpenKNX/Stat/EventTrace.h"
+#include "OpenKNX/Facade.h"
+
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        void __time_critical_func(EventTrace::record)(EventTraceType type, uint16_t id)
+        {
+            if (!_active) return;
+
+#if defined(ARDUINO_ARCH_RP2040)
+            const uint8_t core = rp2040.cpuid();
+#elif defined(ARDUINO_ARCH_ESP32)
+            const uint8_t core = xPortGetCoreID();
+#else
+            const uint8_t core = 0;
+#endif
+
+            const uint32_t state = _lock.lock();
+            EventTraceRecord &entry = _records[_written % OPENKNX_EVENTTRACE_SIZE];
+            entry.time = micros();
+            entry.id = id;
+            entry.type = (uint8_t)type;
+            entry.core = core;
+            _written = _written + 1;
+            _lock.unlock(state);
+        }
+
+        void EventTrace::start()
+        {
+            _active = true;
+        }
+
+        void EventTrace::stop()
+        {
+            _active = false;
+        }
+
+        bool EventTrace::active()
+        {
+            return _active;
+        }
+
+        void EventTrace::clear()
+        {
+            const uint32_t state = _lock.lock();
+            _written = 0;
+            _lock.unlock(state);
+        }
+
+        const char *EventTrace::name(uint16_t id)
+        {
+            switch (id)
+            {
+                case EventTraceLoop:
+                    return "Loop";
+                case EventTraceConsole:
+                    return "Console";
+                case EventTraceKnxStack:
+                    return "KnxStack";
+                case EventTraceModules:
+                    return "Modules";
+                case EventTraceLoop1:
+                    return "Loop1";
+                case EventTraceTimerInterrupt:
+                    return "TimerInterrupt";
+                case EventTraceTimerInterrupt1:
+                    return "TimerInterrupt1";
+                case EventTraceKnxRxISR:
+                    return "KnxRxISR";
+                case EventTraceInputKo:
+                    return "InputKo";
+                case EventTraceFlashErase:
+                    return "FlashErase";
+                case EventTraceFlashWrite:
+                    return "FlashWrite";
+                case EventTraceFlashSave:
+                    return "FlashSave";
+                case EventTraceTasks:
+                    return "Tasks";
+            }
+            return nullptr;
+        }
+
+        void EventTrace::showStatus()
+        {
+            const uint32_t written = _written;
+            openknx.logger.logWithPrefixAndValues("EventTrace", "%s - %u of %u records used (%u events total)",
+                                                  _active ? "running" : "stopped",
+                                                  written < OPENKNX_EVENTTRACE_SIZE ? written : OPENKNX_EVENTTRACE_SIZE,
+                                                  OPENKNX_EVENTTRACE_SIZE, written);
+        }
+
+        void EventTrace::dumpName(uint16_t id, const char *name)
+        {
+            openknx.logger.logWithPrefixAndValues("EventTrace", "N %04X %s", id, name);
+        }
+
+        /*
+         * Output format (parsed by scripts/trace/eventtrace2chrome.py):
+         *   N <id> <name>                   name of an event id
+         *   R <time> <id> <type> <core>    one record (time in us as hex, overflows after ~71min)
+         * Runs as console job (names, module names, then DumpRecordsPerStep records per step)
+         */
+        bool EventTrace::dumpStep(uint16_t step)
+        {
+            if (step == 0)
+            {
+                // pause recording while dumping, otherwise the buffer would be overwritten by the dump itself
+                _dumpResume = _active;
+                _active = false;
+                _dumpWritten = _written;
+
+                openknx.logger.logWithPrefixAndValues("EventTrace", "BEGIN %u %u", OPENKNX_EVENTTRACE_SIZE, _dumpWritten);
+                for (uint16_t id = EventTraceLoop; id < EventTraceModule; id++)
+                {
+                    const char *eventName = name(id);
+                    if (eventName == nullptr) break;
+                    dumpName(id, eventName);
+                }
+                return true;
+            }
+
+            if (step == 1)
+            {
+                for (uint8_t i = 0; i < openknx.modules.count; i++)
+                {
+                    const std::string moduleName = openknx.modules.list[i]->name();
+                    dumpName(EventTraceModule + i, moduleName.c_str());
+#ifdef OPENKNX_DUALCORE
+                    dumpName(EventTraceModule1 + i, (moduleName + "1").c_str());
+#endif
+                }
+                return true;
+            }
+
+            const uint32_t first = _dumpWritten > OPENKNX_EVENTTRACE_SIZE ? _dumpWritten - OPENKNX_EVENTTRACE_SIZE : 0;
+            const uint32_t begin = first + (uint32_t)(step - 2) * DumpRecordsPerStep;
+            const uint32_t end = MIN(begin + DumpRecordsPerStep, _dumpWritten);
+            for (uint32_t i = begin; i < end; i++)
+            {
+                const EventTraceRecord &entry = _records[i % OPENKNX_EVENTTRACE_SIZE];
+                openknx.logger.logWithPrefixAndValues("EventTrace", "R %08X %04X %c %u", entry.time, entry.id, entry.type, entry.core);
+            }
+
+            if (end < _dumpWritten)
+                return true;
+
+            openknx.logger.logWithPrefix("EventTrace", "END");
+            _active = _dumpResume;
+            return false;
+        }
+    } // namespace Stat
+} // namespace OpenKNX
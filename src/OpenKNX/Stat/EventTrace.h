@@ -0,0 +1,116 @@
+#pragma once
+#include "OpenKNX/SpinLock.h"
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+#ifndef OPENKNX_EVENTTRACE_SIZE
+    #ifdef ARDUINO_ARCH_SAMD
+        #define OPENKNX_EVENTTRACE_SIZE 128
+    #else
+        #define OPENKNX_EVENTTRACE_SIZE 512
+    #endif
+#endif
+
+#ifdef OPENKNX_EVENTTRACE
+    #define EVENTTRACE_BEGIN(X) openknx.eventTrace.record(OpenKNX::Stat::EventTraceType::Begin, X);
+    #define EVENTTRACE_END(X) openknx.eventTrace.record(OpenKNX::Stat::EventTraceType::End, X);
+    #define EVENTTRACE_INSTANT(X) openknx.eventTrace.record(OpenKNX::Stat::EventTraceType::Instant, X);
+#else
+    #define EVENTTRACE_BEGIN(X)
+    #define EVENTTRACE_END(X)
+    #define EVENTTRACE_INSTANT(X)
+#endif
+
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        enum class EventTraceType : uint8_t
+        {
+            Begin = 'B',
+            End = 'E',
+            Instant = 'i'
+        };
+
+        /*
+         * Ids of the framework events.
+         * Modules are traced with EventTraceModule + index (loop) and EventTraceModule1 + index (loop1).
+         * Own events of a module should use ids >= EventTraceUser.
+         */
+        enum EventTraceId : uint16_t
+        {
+            EventTraceLoop = 1,
+            EventTraceConsole,
+            EventTraceKnxStack,
+            EventTraceModules,
+            EventTraceLoop1,
+            EventTraceTimerInterrupt,
+            EventTraceTimerInterrupt1,
+            EventTraceKnxRxISR,
+            EventTraceInputKo,
+            EventTraceFlashErase,
+            EventTraceFlashWrite,
+            EventTraceFlashSave,
+            EventTraceTasks,
+            EventTraceModule = 0x100,
+            EventTraceModule1 = 0x200,
+            EventTraceUser = 0x1000,
+        };
+
+        /*
+         * Compact binary trace record (8 bytes)
+         */
+        struct EventTraceRecord
+        {
+            uint32_t time;
+            uint16_t id;
+            uint8_t type;
+            uint8_t core;
+        };
+
+        /*
+         * Event tracer with begin/end/instant events in a ring buffer.
+         * The recording is started with "trace start", the buffer can be dumped over the console ("trace dump") and converted
+         * with scripts/trace/eventtrace2chrome.py into the Chrome-Trace (Perfetto) JSON format.
+         */
+        class EventTrace
+        {
+          private:
+            EventTraceRecord _records[OPENKNX_EVENTTRACE_SIZE];
+            volatile uint32_t _written = 0;
+            // no overhead until the recording is started with "trace start"
+            volatile bool _active = false;
+            SpinLock _lock;
+
+            // state of the dump job
+            static constexpr uint16_t DumpRecordsPerStep = 16;
+            uint32_t _dumpWritten = 0;
+            bool _dumpResume = false;
+            void dumpName(uint16_t id, const char *name);
+
+          public:
+            /*
+             * Store an event. Can be called from interrupts and both cores.
+             */
+            void record(EventTraceType type, uint16_t id);
+
+            void start();
+            void stop();
+            void clear();
+            bool active();
+
+            /*
+             * Returns the name of a framework event (or nullptr for module and user events)
+             */
+            static const char *name(uint16_t id);
+
+            void showStatus();
+            /*
+             * One step of the dump ("trace dump" runs it as console job)
+             * @return true if more steps follow
+             */
+            bool dumpStep(uint16_t step);
+        };
+    } // namespace Stat
+} // namespace OpenKNX
@@ -0,0 +1,117 @@
+#include "OpenKNX/Stat/HeapHook.h"
+
+#ifdef ARDUINO_ARCH_RP2040
+    #include "OpenKNX/SpinLock.h"
+    #include <malloc.h>
+    #include <new>
+    #include <stdlib.h>
+
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        static int32_t heapUsed = 0;
+        // free heap + heapUsed at the last calibration (0 = not calibrated yet)
+        static int32_t heapBase = 0;
+        static int32_t heapMin = 0x7FFFFFFF;
+
+        /*
+         * The lock is constructed on first use, because allocations can happen before the static initialization is finished
+         */
+        static SpinLock &heapHookLock()
+        {
+            static SpinLock lock;
+            return lock;
+        }
+
+        void __time_critical_func(heapAllocated)(void *memory)
+        {
+            if (memory == nullptr)
+                return;
+
+            const int32_t size = malloc_usable_size(memory);
+            SpinLock &lock = heapHookLock();
+            const uint32_t state = lock.lock();
+            heapUsed += size;
+            if (heapBase != 0 && heapBase - heapUsed < heapMin)
+                heapMin = heapBase - heapUsed;
+            lock.unlock(state);
+        }
+
+        void __time_critical_func(heapReleased)(void *memory)
+        {
+            if (memory == nullptr)
+                return;
+
+            const int32_t size = malloc_usable_size(memory);
+            SpinLock &lock = heapHookLock();
+            const uint32_t state = lock.lock();
+            heapUsed -= size;
+            lock.unlock(state);
+        }
+
+        void heapCalibrate(int32_t free)
+        {
+            SpinLock &lock = heapHookLock();
+            const uint32_t state = lock.lock();
+            heapBase = free + heapUsed;
+            if (free < heapMin)
+                heapMin = free;
+            lock.unlock(state);
+        }
+
+        int32_t heapFreeMin()
+        {
+            return heapMin;
+        }
+
+        static inline void *allocate(size_t size)
+        {
+            void *memory = malloc(size ? size : 1);
+            heapAllocated(memory);
+            return memory;
+        }
+
+        static inline void release(void *memory)
+        {
+            heapReleased(memory);
+            free(memory);
+        }
+    } // namespace Stat
+} // namespace OpenKNX
+
+    // the heap tracker replaces the operators and calls the hook itself
+    #ifndef OPENKNX_HEAP_TRACKER
+void *operator new(size_t size)
+{
+    void *memory = OpenKNX::Stat::allocate(size);
+    if (memory == nullptr) std::__throw_bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return OpenKNX::Stat::allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return OpenKNX::Stat::allocate(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    OpenKNX::Stat::release(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    OpenKNX::Stat::release(memory);
+}
+    #endif
+#endif
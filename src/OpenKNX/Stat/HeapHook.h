@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        /*
+         * Running minimum of the free heap, kept by the replaced operator new/delete without mallinfo.
+         * The bytes of new (malloc_usable_size) are counted against the free heap of the last calibration.
+         * Direct malloc calls are only seen by the calibration (OPENKNX_HEAP_SAMPLE_INTERVAL in loop context).
+         */
+        void heapAllocated(void *memory);
+        void heapReleased(void *memory);
+
+        /*
+         * Set the measured free heap (mallinfo) as new base of the running minimum
+         */
+        void heapCalibrate(int32_t free);
+        int32_t heapFreeMin();
+    } // namespace Stat
+} // namespace OpenKNX
+#endif
@@ -0,0 +1,187 @@
+#include "OpenKNX/Stat/HeapTracker.h"
+
+#ifdef OPENKNX_HEAP_TRACKER
+    #include "OpenKNX/Facade.h"
+    #include "OpenKNX/SpinLock.h"
+    #include "OpenKNX/Stat/HeapHook.h"
+    #include <new>
+    #include <stdlib.h>
+
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        /*
+         * Header in front of each allocation (keeps the 8 byte alignment of malloc)
+         */
+        struct HeapHeader
+        {
+            uint32_t size;
+            uint8_t owner;
+            uint8_t reserved[3];
+        };
+
+        volatile uint8_t HeapTracker::_owner[2] = {HeapOwnerFramework, HeapOwnerFramework};
+        HeapOwnerStat HeapTracker::_stats[HeapOwnerCount] = {};
+        uint32_t HeapTracker::_shown = 0;
+
+        /*
+         * The lock is constructed on first use, because allocations can happen before the static initialization is finished
+         */
+        static SpinLock &heapTrackerLock()
+        {
+            static SpinLock lock;
+            return lock;
+        }
+
+        uint8_t __time_critical_func(HeapTracker::currentCore)()
+        {
+    #if defined(ARDUINO_ARCH_RP2040)
+            return rp2040.cpuid();
+    #elif defined(ARDUINO_ARCH_ESP32)
+            return xPortGetCoreID();
+    #else
+            return 0;
+    #endif
+        }
+
+        uint8_t HeapTracker::enter(uint8_t owner)
+        {
+            const uint8_t core = currentCore();
+            const uint8_t previous = _owner[core];
+            _owner[core] = owner;
+            return previous;
+        }
+
+        void HeapTracker::leave(uint8_t previous)
+        {
+            _owner[currentCore()] = previous;
+        }
+
+        uint8_t HeapTracker::allocated(size_t size)
+        {
+            const uint8_t owner = _owner[currentCore()];
+            SpinLock &lock = heapTrackerLock();
+            const uint32_t state = lock.lock();
+            HeapOwnerStat &stat = _stats[owner];
+            stat.live += size;
+            stat.allocs++;
+            if (stat.live > stat.peak) stat.peak = stat.live;
+            lock.unlock(state);
+            return owner;
+        }
+
+        void HeapTracker::freed(uint8_t owner, size_t size)
+        {
+            SpinLock &lock = heapTrackerLock();
+            const uint32_t state = lock.lock();
+            HeapOwnerStat &stat = _stats[owner];
+            stat.live -= size;
+            stat.frees++;
+            lock.unlock(state);
+        }
+
+        const char *HeapTracker::name(uint8_t owner)
+        {
+            switch (owner)
+            {
+                case HeapOwnerFramework:
+                    return "Framework";
+                case HeapOwnerKnxStack:
+                    return "KnxStack";
+                case HeapOwnerConsole:
+                    return "Console";
+                case HeapOwnerLogger:
+                    return "Logger";
+                case HeapOwnerFlash:
+                    return "Flash";
+            }
+            return "Unknown";
+        }
+
+        void HeapTracker::showStatus()
+        {
+            const uint32_t now = millis();
+            const uint32_t elapsed = now - _shown;
+            _shown = now;
+
+            logInfo("HeapTracker", "%-16s %8s %8s %8s %8s %8s", "Owner", "Live", "Peak", "Allocs", "Frees", "Allocs/s");
+            for (uint8_t owner = 0; owner < HeapOwnerCount; owner++)
+            {
+                SpinLock &lock = heapTrackerLock();
+                const uint32_t state = lock.lock();
+                const HeapOwnerStat stat = _stats[owner];
+                _stats[owner].shownAllocs = stat.allocs;
+                lock.unlock(state);
+
+                if (stat.allocs == 0)
+                    continue;
+
+                const uint8_t module = owner - HeapOwnerModule;
+                const std::string label = owner < HeapOwnerModule || module >= openknx.modules.count ? name(owner) : openknx.modules.list[module]->name();
+                const uint32_t rate = elapsed ? (uint64_t)(stat.allocs - stat.shownAllocs) * 1000 / elapsed : 0;
+                logInfo("HeapTracker", "%-16s %8u %8u %8u %8u %8u", label.c_str(), stat.live, stat.peak, stat.allocs, stat.frees, rate);
+            }
+        }
+
+        static inline void *allocate(size_t size)
+        {
+            HeapHeader *header = (HeapHeader *)malloc(sizeof(HeapHeader) + size);
+            if (header == nullptr)
+                return nullptr;
+
+    #ifdef ARDUINO_ARCH_RP2040
+            heapAllocated(header);
+    #endif
+            header->size = size;
+            header->owner = HeapTracker::allocated(size);
+            return header + 1;
+        }
+
+        static inline void release(void *memory)
+        {
+            if (memory == nullptr)
+                return;
+
+            HeapHeader *header = (HeapHeader *)memory - 1;
+            HeapTracker::freed(header->owner, header->size);
+    #ifdef ARDUINO_ARCH_RP2040
+            heapReleased(header);
+    #endif
+            free(header);
+        }
+    } // namespace Stat
+} // namespace OpenKNX
+
+void *operator new(size_t size)
+{
+    void *memory = OpenKNX::Stat::allocate(size);
+    if (memory == nullptr) std::__throw_bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return OpenKNX::Stat::allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return OpenKNX::Stat::allocate(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    OpenKNX::Stat::release(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    OpenKNX::Stat::release(memory);
+}
+#endif
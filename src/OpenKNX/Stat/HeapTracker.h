@@ -0,0 +1,92 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+
+#ifdef OPENKNX_HEAP_TRACKER
+    #define HEAPTRACK_SCOPE(X) OpenKNX::Stat::HeapOwnerScope heapOwnerScope(X);
+#else
+    #define HEAPTRACK_SCOPE(X)
+#endif
+
+#ifdef OPENKNX_HEAP_TRACKER
+namespace OpenKNX
+{
+    namespace Stat
+    {
+        /*
+         * Owners of the allocations. Modules are tracked with HeapOwnerModule + index.
+         */
+        enum HeapOwner : uint8_t
+        {
+            HeapOwnerFramework = 0,
+            HeapOwnerKnxStack,
+            HeapOwnerConsole,
+            HeapOwnerLogger,
+            HeapOwnerFlash,
+            HeapOwnerModule,
+            HeapOwnerCount = HeapOwnerModule + OPENKNX_MAX_MODULES,
+        };
+
+        struct HeapOwnerStat
+        {
+            uint32_t live;
+            uint32_t peak;
+            uint32_t allocs;
+            uint32_t frees;
+            uint32_t shownAllocs;
+        };
+
+        /*
+         * Attribution of the heap usage to the modules and framework components.
+         *
+         * The replaced operator new/delete store the owner and the size in a header in front of each allocation,
+         * so the live bytes of the owner can be reduced on delete (also if another owner frees it).
+         * The owner is the current HEAPTRACK_SCOPE of the core.
+         * Direct malloc/free calls are not tracked.
+         */
+        class HeapTracker
+        {
+          private:
+            static volatile uint8_t _owner[2];
+            static HeapOwnerStat _stats[HeapOwnerCount];
+            static uint32_t _shown;
+
+            static const char *name(uint8_t owner);
+
+          public:
+            static uint8_t currentCore();
+
+            /*
+             * Set the owner of the current core
+             * @return previous owner
+             */
+            static uint8_t enter(uint8_t owner);
+            static void leave(uint8_t previous);
+
+            /*
+             * Called by the replaced operators (must not allocate)
+             */
+            static uint8_t allocated(size_t size);
+            static void freed(uint8_t owner, size_t size);
+
+            /*
+             * Show live bytes, peak bytes and allocation rate since the last call
+             */
+            static void showStatus();
+        };
+
+        /*
+         * Attribute all allocations of the current core within the scope to the owner
+         */
+        class HeapOwnerScope
+        {
+          private:
+            uint8_t _previous;
+
+          public:
+            explicit HeapOwnerScope(uint8_t owner) : _previous(HeapTracker::enter(owner)){};
+            ~HeapOwnerScope() { HeapTracker::leave(_previous); };
+        };
+    } // namespace Stat
+} // namespace OpenKNX
+#endif
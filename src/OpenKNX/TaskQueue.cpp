@@ -0,0 +1,79 @@
+#include "OpenKNX/TaskQueue.h"
+#include "OpenKNX/Facade.h"
+
+namespace OpenKNX
+{
+    std::string TaskQueue::logPrefix()
+    {
+        return "TaskQueue";
+    }
+
+    bool __time_critical_func(TaskQueue::submit)(TaskFunction function, void *arg /* = nullptr */)
+    {
+        bool added = false;
+        const uint32_t state = _lock.lock();
+        if (_pending < OPENKNX_TASKQUEUE_SIZE)
+        {
+            _tasks[_head].function = function;
+            _tasks[_head].arg = arg;
+            _head = (_head + 1) % OPENKNX_TASKQUEUE_SIZE;
+            _pending = _pending + 1;
+            if (_pending > _pendingMax) _pendingMax = _pending;
+            added = true;
+        }
+        else
+        {
+            _rejected++;
+        }
+        _lock.unlock(state);
+        return added;
+    }
+
+    bool __time_critical_func(TaskQueue::pop)(Task &task)
+    {
+        // cheap check without lock
+        if (_pending == 0) return false;
+
+        bool found = false;
+        const uint32_t state = _lock.lock();
+        if (_pending > 0)
+        {
+            task = _tasks[_tail];
+            _tail = (_tail + 1) % OPENKNX_TASKQUEUE_SIZE;
+            _pending = _pending - 1;
+            found = true;
+        }
+        _lock.unlock(state);
+        return found;
+    }
+
+    bool TaskQueue::process()
+    {
+        Task task;
+        if (!pop(task)) return false;
+
+        task.function(task.arg);
+
+#if defined(ARDUINO_ARCH_RP2040)
+        _executed[rp2040.cpuid()]++;
+#elif defined(ARDUINO_ARCH_ESP32)
+        // on ESP32 core1 runs arduino loop (core0 of OpenKNX)
+        _executed[!xPortGetCoreID()]++;
+#else
+        _executed[0]++;
+#endif
+        return true;
+    }
+
+    uint16_t TaskQueue::pending()
+    {
+        return _pending;
+    }
+
+    void TaskQueue::showStatus()
+    {
+        logInfoP("Pending: %u (max %u of %u)", _pending, _pendingMax, OPENKNX_TASKQUEUE_SIZE);
+        logInfoP("Rejected: %u", _rejected);
+        logInfoP("Executed: %u (core0) / %u (core1)", _executed[0], _executed[1]);
+    }
+} // namespace OpenKNX
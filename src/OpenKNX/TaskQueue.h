@@ -0,0 +1,66 @@
+#pragma once
+#include "OpenKNX/SpinLock.h"
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+#ifndef OPENKNX_TASKQUEUE_SIZE
+    #define OPENKNX_TASKQUEUE_SIZE 32
+#endif
+
+namespace OpenKNX
+{
+    typedef void (*TaskFunction)(void *arg);
+
+    struct Task
+    {
+        TaskFunction function;
+        void *arg;
+    };
+
+    /*
+     * Shared queue of independent jobs (e.g. channel evaluations or sensor conversions).
+     *
+     * Tasks are executed by core0 within its free loop time (after the module loops)
+     * and continuously by core1 after the loop1 of the modules. So the load is shared
+     * automatically between both cores when OPENKNX_DUALCORE is used.
+     *
+     * Attention: A task can be executed on both cores and the order of execution is only
+     * guaranteed on single-core. A task must not block and should be short (<1ms).
+     */
+    class TaskQueue
+    {
+      private:
+        Task _tasks[OPENKNX_TASKQUEUE_SIZE];
+        volatile uint16_t _head = 0;
+        volatile uint16_t _tail = 0;
+        volatile uint16_t _pending = 0;
+        uint16_t _pendingMax = 0;
+        uint32_t _rejected = 0;
+        uint32_t _executed[2] = {};
+        SpinLock _lock;
+
+        bool pop(Task &task);
+
+      public:
+        /*
+         * Add a task to the queue. Can be called from both cores and from interrupts.
+         * @return false if the queue is full (the task is not added)
+         */
+        bool submit(TaskFunction function, void *arg = nullptr);
+
+        /*
+         * Execute the next task on the calling core
+         * @return false if there was no pending task
+         */
+        bool process();
+
+        /*
+         * Number of tasks waiting for execution
+         */
+        uint16_t pending();
+
+        void showStatus();
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
@@ -83,11 +83,18 @@ ESP32Timer ITimer(SELECTED_TIMER);
 #endif
 
 #ifdef ARDUINO_ARCH_RP2040
+    #ifdef OPENKNX_TICKLESS
+int64_t __isr __time_critical_func(timerInterruptAlarm)(alarm_id_t id, void *userData)
+{
+    return openknx.timerInterrupt.alarm();
+}
+    #else
 bool __isr __time_critical_func(timerInterruptCallback)(repeating_timer *t)
 {
     openknx.timerInterrupt.interrupt();
     return true;
 }
+    #endif
     #ifdef OPENKNX_DUALCORE
         #ifdef ARDUINO_ARCH_RP2040
 bool __isr __time_critical_func(timerInterruptCallback1)(repeating_timer *t)
@@ -105,7 +112,11 @@ namespace OpenKNX
     {
 #if defined(ARDUINO_ARCH_RP2040)
         _alarmPool = alarm_pool_create(1, 16);
+    #ifdef OPENKNX_TICKLESS
+        _alarm = alarm_pool_add_alarm_in_us(_alarmPool, OPENKNX_INTERRUPT_TIMER_MS * 1000, timerInterruptAlarm, NULL, true);
+    #else
         alarm_pool_add_repeating_timer_ms(_alarmPool, -OPENKNX_INTERRUPT_TIMER_MS, timerInterruptCallback, NULL, &_repeatingTimer);
+    #endif
 // add_repeating_timer_ms(-OPENKNX_INTERRUPT_TIMER_MS, timerInterruptCallback, NULL, &_repeatingTimer);
 #elif defined(ARDUINO_ARCH_SAMD)
         ITimer.attachInterruptInterval_MS(OPENKNX_INTERRUPT_TIMER_MS, []() -> void {
@@ -121,46 +132,105 @@ namespace OpenKNX
 
     void __isr __time_critical_func(TimerInterrupt::interrupt)()
     {
+        EVENTTRACE_BEGIN(Stat::EventTraceTimerInterrupt);
         _time = millis();
 
         processStats();
-#ifndef OPENKNX_SERIALLED_ENABLE
+#if !defined(OPENKNX_SERIALLED_ENABLE) || !defined(ARDUINO_ARCH_ESP32)
+        // ESP32 serial leds are processed by the timer of the SerialLedManager
         processLeds();
+#endif
+#if defined(OPENKNX_SERIALLED_ENABLE) && defined(ARDUINO_ARCH_RP2040)
+        openknx.ledManager.writeLeds();
 #endif
         processButtons();
+#ifndef ARDUINO_ARCH_RP2040
+        // RP2040 has an own alarm for the timer wheel
+        openknx.timers.interrupt();
+#endif
+        EVENTTRACE_END(Stat::EventTraceTimerInterrupt);
     }
 
-    void TimerInterrupt::processStats()
+#ifdef OPENKNX_TICKLESS
+    int64_t __isr __time_critical_func(TimerInterrupt::alarm)()
     {
-#ifdef ARDUINO_ARCH_RP2040
-        openknx.common.collectStackStats();
+        _wakeup = false;
+        interrupt();
+
+        // woken up during the interrupt (e.g. a led changed by a button callback)
+        if (_wakeup)
+            return OPENKNX_INTERRUPT_TIMER_MS * 1000;
+
+        return sleepTime() * 1000;
+    }
+
+    void __time_critical_func(TimerInterrupt::wakeup)()
+    {
+        const uint32_t state = _lock.lock();
+        _wakeup = true;
+        // a running alarm can not be cancelled, but it checks _wakeup before it is rescheduled
+        if (_alarm > 0 && alarm_pool_cancel_alarm(_alarmPool, _alarm))
+            _alarm = alarm_pool_add_alarm_in_us(_alarmPool, 100, timerInterruptAlarm, NULL, true);
+        _lock.unlock(state);
+    }
+
+    /*
+     * Time in ms until the next interrupt is needed
+     */
+    uint32_t __time_critical_func(TimerInterrupt::sleepTime)()
+    {
+        uint32_t next = _time + OPENKNX_TICKLESS_MAX_SLEEP;
+        auto earliest = [&next](uint32_t time) {
+            if ((int32_t)(time - next) < 0) next = time;
+        };
+
+        earliest(openknx.progLed.nextUpdate());
+    #ifdef INFO1_LED_PIN
+        earliest(openknx.info1Led.nextUpdate());
+    #endif
+    #ifdef INFO2_LED_PIN
+        earliest(openknx.info2Led.nextUpdate());
+    #endif
+    #ifdef INFO3_LED_PIN
+        earliest(openknx.info3Led.nextUpdate());
+    #endif
+    #ifdef OPENKNX_SERIALLED_ENABLE
+        if (openknx.ledManager.pending()) earliest(_time);
+    #endif
+
+        // buttons are polled only while pressed, bouncing or waiting for a further click
+        if (openknx.buttons.active()) earliest(_time);
+
+        const int32_t sleep = next - _time;
+        return MAX(sleep, OPENKNX_INTERRUPT_TIMER_MS);
+    }
 #endif
+
+    void TimerInterrupt::processStats()
+    {
+        // the stack high water mark is determined lazily (painted stack / freertos)
         openknx.common.collectHeapStats();
     }
 
     void TimerInterrupt::processButtons()
     {
-        openknx.progButton.loop();
-#ifdef FUNC1_BUTTON_PIN
-        openknx.func1Button.loop();
-#endif
-#ifdef FUNC2_BUTTON_PIN
-        openknx.func2Button.loop();
-#endif
-#ifdef FUNC3_BUTTON_PIN
-        openknx.func3Button.loop();
-#endif
+        openknx.buttons.process(_time);
     }
     void TimerInterrupt::processLeds()
     {
+#ifndef OPENKNX_TICKLESS
+        // the leds are processed alternately - tickless processes all, because the time of the interrupts is irregular
         if (_time % 2)
+#endif
         {
             openknx.progLed.loop();
 #ifdef INFO2_LED_PIN
             openknx.info2Led.loop();
 #endif
         }
+#ifndef OPENKNX_TICKLESS
         else
+#endif
         {
 #ifdef INFO1_LED_PIN
             openknx.info1Led.loop();
@@ -183,15 +253,24 @@ namespace OpenKNX
     {
     #ifdef ARDUINO_ARCH_RP2040
         _alarmPool1 = alarm_pool_create(2, 16);
+        #ifdef OPENKNX_TICKLESS
+        // only the stats of core1 - the leds are processed by core0
+        alarm_pool_add_repeating_timer_ms(_alarmPool1, -OPENKNX_TICKLESS_MAX_SLEEP, timerInterruptCallback1, NULL, &_repeatingTimer1);
+        #else
         alarm_pool_add_repeating_timer_ms(_alarmPool1, -OPENKNX_INTERRUPT_TIMER_MS, timerInterruptCallback1, NULL, &_repeatingTimer1);
+        #endif
     #endif
     }
 
     void __isr __time_critical_func(TimerInterrupt::interrupt1)()
     {
+        EVENTTRACE_BEGIN(Stat::EventTraceTimerInterrupt1);
         _time1 = millis();
         processStats();
+#ifndef OPENKNX_TICKLESS
         processLeds();
+#endif
+        EVENTTRACE_END(Stat::EventTraceTimerInterrupt1);
     }
 
     #ifdef ARDUINO_ARCH_RP2040
@@ -5,6 +5,20 @@
 // Interval of interrupt for leds and free memory collector
 #define OPENKNX_INTERRUPT_TIMER_MS 3
 
+/*
+ * Tickless: Instead of the fixed interval, the interrupt sleeps until the next transition of a led, while a button is active
+ * or max OPENKNX_TICKLESS_MAX_SLEEP (stats). Changes of leds and buttons wake it up. OPENKNX_INTERRUPT_TIMER_MS is the min interval.
+ */
+#ifdef OPENKNX_TICKLESS
+    #ifndef ARDUINO_ARCH_RP2040
+        #error OPENKNX_TICKLESS is only supported on RP2040
+    #endif
+    #ifndef OPENKNX_TICKLESS_MAX_SLEEP
+        #define OPENKNX_TICKLESS_MAX_SLEEP 100
+    #endif
+    #include "OpenKNX/SpinLock.h"
+#endif
+
 namespace OpenKNX
 {
     // IMPORTANT!!! The method millis() and micros() are not incremented further in the interrupt!
@@ -28,9 +42,28 @@ namespace OpenKNX
         inline void processButtons();
         inline void processLeds();
 
+#ifdef OPENKNX_TICKLESS
+        alarm_id_t _alarm = 0;
+        volatile bool _wakeup = false;
+        SpinLock _lock;
+        uint32_t sleepTime();
+#endif
+
       public:
         void init();
         void interrupt();
+#ifdef OPENKNX_TICKLESS
+        /*
+         * Called by the alarm
+         * @return us until the next call
+         */
+        int64_t alarm();
+
+        /*
+         * Process the leds and buttons as soon as possible. Can be called from both cores and from interrupts.
+         */
+        void wakeup();
+#endif
 #ifdef ARDUINO_ARCH_RP2040
         alarm_pool_t *alarmPool();
 #endif
@@ -0,0 +1,288 @@
+#include "OpenKNX/TimerWheel.h"
+#include "OpenKNX/Facade.h"
+
+static_assert((OPENKNX_TIMERWHEEL_SLOTS & (OPENKNX_TIMERWHEEL_SLOTS - 1)) == 0, "OPENKNX_TIMERWHEEL_SLOTS must be a power of two");
+
+#ifdef ARDUINO_ARCH_RP2040
+int64_t __isr __time_critical_func(timerWheelAlarm)(alarm_id_t id, void *userData)
+{
+    return openknx.timers.alarm();
+}
+#endif
+
+namespace OpenKNX
+{
+    std::string TimerWheel::logPrefix()
+    {
+        return "TimerWheel";
+    }
+
+    void TimerWheel::init()
+    {
+        // RP2040: the alarm is started by the first schedule
+        _tickTime = micros() + OPENKNX_TIMERWHEEL_RESOLUTION;
+    }
+
+    /*
+     * Link the timer into the slot of its due tick (lock must be held)
+     */
+    void __time_critical_func(TimerWheel::insert)(Timer &timer)
+    {
+        const int32_t delta = timer.due - _tickTime;
+        const uint32_t ticks = delta <= 0 ? 0 : (delta + OPENKNX_TIMERWHEEL_RESOLUTION - 1) / OPENKNX_TIMERWHEEL_RESOLUTION;
+        timer.slot = (_tick + ticks) & (OPENKNX_TIMERWHEEL_SLOTS - 1);
+        timer.prev = nullptr;
+        timer.next = _slots[timer.slot];
+        if (timer.next != nullptr) timer.next->prev = &timer;
+        _slots[timer.slot] = &timer;
+        timer.state = TimerState::Scheduled;
+#ifdef ARDUINO_ARCH_RP2040
+        _scheduled++;
+#endif
+    }
+
+    /*
+     * Remove the timer from the wheel or the pending list (lock must be held)
+     */
+    void __time_critical_func(TimerWheel::unlink)(Timer &timer)
+    {
+#ifdef ARDUINO_ARCH_RP2040
+        if (timer.state == TimerState::Scheduled) _scheduled--;
+#endif
+        Timer *&head = timer.state == TimerState::Pending ? _pendingHead : _slots[timer.slot];
+        if (timer.prev != nullptr)
+            timer.prev->next = timer.next;
+        else
+            head = timer.next;
+
+        if (timer.next != nullptr)
+            timer.next->prev = timer.prev;
+        else if (timer.state == TimerState::Pending)
+            _pendingTail = timer.prev;
+
+        timer.next = nullptr;
+        timer.prev = nullptr;
+    }
+
+    void TimerWheel::schedule(Timer &timer, uint32_t delay, uint32_t interval /* = 0 */)
+    {
+        const uint32_t state = _lock.lock();
+        if (timer.state == TimerState::Scheduled || timer.state == TimerState::Pending)
+            unlink(timer);
+
+        if (!timer.known)
+        {
+            timer.known = true;
+            timer.registered = _registered;
+            _registered = &timer;
+        }
+
+#ifdef ARDUINO_ARCH_RP2040
+        const bool start = arm();
+#endif
+        timer.due = micros() + delay;
+        timer.interval = interval;
+        insert(timer);
+        _lock.unlock(state);
+
+#ifdef ARDUINO_ARCH_RP2040
+        if (start) startAlarm();
+#endif
+    }
+
+    void TimerWheel::cancel(Timer &timer)
+    {
+        const uint32_t state = _lock.lock();
+        if (timer.state == TimerState::Scheduled || timer.state == TimerState::Pending)
+            unlink(timer);
+
+        timer.state = TimerState::Idle;
+        _lock.unlock(state);
+    }
+
+    void __time_critical_func(TimerWheel::execute)(Timer &timer)
+    {
+        const uint32_t start = micros();
+        const uint32_t late = start - timer.due;
+        timer.function(timer.arg);
+        const uint32_t runtime = micros() - start;
+
+        timer.runs++;
+        timer.runtimeTotal += runtime;
+        if (runtime > timer.runtimeMax) timer.runtimeMax = runtime;
+        if (late > timer.lateMax) timer.lateMax = late;
+    }
+
+    /*
+     * Repeat a periodic timer after its callback - unless it was cancelled or scheduled again by the callback
+     */
+    void __time_critical_func(TimerWheel::reschedule)(Timer &timer, uint32_t now)
+    {
+#ifdef ARDUINO_ARCH_RP2040
+        bool start = false;
+#endif
+        const uint32_t state = _lock.lock();
+        if (timer.state == TimerState::Running)
+        {
+            if (timer.interval > 0)
+            {
+#ifdef ARDUINO_ARCH_RP2040
+                start = arm();
+#endif
+                timer.due += timer.interval;
+                // skip missed periods, but keep the phase
+                if ((int32_t)(timer.due - now) <= 0)
+                {
+                    const uint32_t missed = (now - timer.due) / timer.interval + 1;
+                    timer.due += missed * timer.interval;
+                    _skipped += missed;
+                }
+                insert(timer);
+            }
+            else
+            {
+                timer.state = TimerState::Idle;
+            }
+        }
+        _lock.unlock(state);
+
+#ifdef ARDUINO_ARCH_RP2040
+        if (start) startAlarm();
+#endif
+    }
+
+    void __isr __time_critical_func(TimerWheel::interrupt)()
+    {
+        const uint32_t now = micros();
+        Timer *fire = nullptr;
+
+        const uint32_t state = _lock.lock();
+        // max one revolution - all slots are checked then
+        for (uint16_t i = 0; i < OPENKNX_TIMERWHEEL_SLOTS && (int32_t)(now - _tickTime) >= 0; i++)
+        {
+            const uint16_t slot = _tick & (OPENKNX_TIMERWHEEL_SLOTS - 1);
+            Timer *timer = _slots[slot];
+            while (timer != nullptr)
+            {
+                Timer *next = timer->next;
+                if ((int32_t)(now - timer->due) >= 0)
+                {
+                    unlink(*timer);
+                    if (timer->context == TimerContext::Interrupt)
+                    {
+                        timer->state = TimerState::Running;
+                        timer->fired = fire;
+                        fire = timer;
+                    }
+                    else
+                    {
+                        timer->state = TimerState::Pending;
+                        timer->prev = _pendingTail;
+                        if (_pendingTail != nullptr)
+                            _pendingTail->next = timer;
+                        else
+                            _pendingHead = timer;
+                        _pendingTail = timer;
+                    }
+                }
+                timer = next;
+            }
+            _tick++;
+            _tickTime += OPENKNX_TIMERWHEEL_RESOLUTION;
+        }
+
+        // fallen behind more than one revolution (e.g. blocked interrupts)
+        if ((int32_t)(now - _tickTime) >= 0)
+            _tickTime = now + OPENKNX_TIMERWHEEL_RESOLUTION;
+        _lock.unlock(state);
+
+        while (fire != nullptr)
+        {
+            Timer *timer = fire;
+            fire = timer->fired;
+            timer->fired = nullptr;
+            // cancelled or scheduled again by a previous callback or the other core
+            if (timer->state != TimerState::Running)
+                continue;
+
+            execute(*timer);
+            reschedule(*timer, now);
+        }
+
+        const uint32_t runtime = micros() - now;
+        if (runtime > _interruptMax) _interruptMax = runtime;
+    }
+
+#ifdef ARDUINO_ARCH_RP2040
+    /*
+     * Mark the wheel as running (lock must be held)
+     * @return true if the alarm was stopped and has to be started
+     */
+    bool __time_critical_func(TimerWheel::arm)()
+    {
+        if (_armed)
+            return false;
+
+        // continue with the current time
+        _armed = true;
+        _tickTime = micros() + OPENKNX_TIMERWHEEL_RESOLUTION;
+        return true;
+    }
+
+    void TimerWheel::startAlarm()
+    {
+        alarm_pool_add_alarm_in_us(openknx.timerInterrupt.alarmPool(), OPENKNX_TIMERWHEEL_RESOLUTION, timerWheelAlarm, NULL, true);
+    }
+
+    int64_t __isr __time_critical_func(TimerWheel::alarm)()
+    {
+        interrupt();
+
+        const uint32_t state = _lock.lock();
+        const bool stop = _scheduled == 0;
+        if (stop) _armed = false;
+        _lock.unlock(state);
+
+        return stop ? 0 : -(int64_t)OPENKNX_TIMERWHEEL_RESOLUTION;
+    }
+#endif
+
+    void TimerWheel::loop()
+    {
+        while (true)
+        {
+            const uint32_t state = _lock.lock();
+            Timer *timer = _pendingHead;
+            if (timer != nullptr)
+            {
+                unlink(*timer);
+                timer->state = TimerState::Running;
+            }
+            _lock.unlock(state);
+
+            if (timer == nullptr)
+                return;
+
+            execute(*timer);
+            reschedule(*timer, micros());
+        }
+    }
+
+    void TimerWheel::showStatus()
+    {
+        logInfoP("Resolution: %u us, %u slots", OPENKNX_TIMERWHEEL_RESOLUTION, OPENKNX_TIMERWHEEL_SLOTS);
+        logInfoP("Interrupt: max %u us, skipped periods %u", _interruptMax, _skipped);
+        for (Timer *timer = _registered; timer != nullptr; timer = timer->registered)
+        {
+            logInfoP("%-16s %-9s %-9s every %8u us  runs %8u  avg %5u us  max %5u us  late max %5u us",
+                     timer->name,
+                     timer->context == TimerContext::Interrupt ? "interrupt" : "loop",
+                     timer->state == TimerState::Idle ? "idle" : "scheduled",
+                     timer->interval,
+                     timer->runs,
+                     timer->runs ? timer->runtimeTotal / timer->runs : 0,
+                     timer->runtimeMax,
+                     timer->lateMax);
+        }
+    }
+} // namespace OpenKNX
@@ -0,0 +1,147 @@
+#pragma once
+#include "OpenKNX/SpinLock.h"
+#include "OpenKNX/TimerInterrupt.h"
+#include "OpenKNX/defines.h"
+#include <Arduino.h>
+#include <string>
+
+// number of slots of the wheel (power of two)
+#ifndef OPENKNX_TIMERWHEEL_SLOTS
+    #define OPENKNX_TIMERWHEEL_SLOTS 64
+#endif
+
+// resolution in us - only RP2040 has an own alarm for the wheel, otherwise it is advanced by the timer interrupt
+#ifdef ARDUINO_ARCH_RP2040
+    #ifndef OPENKNX_TIMERWHEEL_RESOLUTION
+        #define OPENKNX_TIMERWHEEL_RESOLUTION 1000
+    #endif
+#else
+    #undef OPENKNX_TIMERWHEEL_RESOLUTION
+    #define OPENKNX_TIMERWHEEL_RESOLUTION (OPENKNX_INTERRUPT_TIMER_MS * 1000)
+#endif
+
+namespace OpenKNX
+{
+    typedef void (*TimerFunction)(void *arg);
+
+    enum class TimerContext : uint8_t
+    {
+        Interrupt, // directly in the timer interrupt (core0) - must be short and must not log
+        Loop,      // deferred and executed in the loop of core0
+    };
+
+    enum class TimerState : uint8_t
+    {
+        Idle,
+        Scheduled, // waiting in the wheel
+        Pending,   // due and waiting for the loop
+        Running,
+    };
+
+    /*
+     * A scheduled callback. The object is owned by the caller and must stay valid once it was scheduled
+     * (e.g. a member of the module), because it is linked into the wheel without any allocation.
+     */
+    struct Timer
+    {
+        const char *name;
+        TimerFunction function;
+        void *arg;
+        TimerContext context;
+
+        // managed by the TimerWheel
+        volatile TimerState state = TimerState::Idle;
+        uint16_t slot = 0;
+        uint32_t due = 0;
+        uint32_t interval = 0;
+        Timer *next = nullptr;
+        Timer *prev = nullptr;
+        Timer *registered = nullptr;
+        Timer *fired = nullptr; // list of the due interrupt timers (next/prev can be changed by schedule during the callbacks)
+        bool known = false;
+
+        // accounting
+        uint32_t runs = 0;
+        uint32_t runtimeTotal = 0;
+        uint32_t runtimeMax = 0;
+        uint32_t lateMax = 0;
+
+        Timer(const char *name, TimerFunction function, void *arg = nullptr, TimerContext context = TimerContext::Loop)
+            : name(name), function(function), arg(arg), context(context){};
+    };
+
+    /*
+     * Scheduled callbacks for the modules (openknx.timers). Delays are given in us, but due timers are only detected
+     * on the ticks of the wheel (default 1 ms, see OPENKNX_TIMERWHEEL_RESOLUTION).
+     *
+     * Hashed timer wheel: a timer is linked into the slot of its due tick, so schedule and cancel are O(1).
+     * Each tick only the timers of the current slot are checked. Timers further away than one revolution
+     * stay in their slot and are skipped until they are due.
+     *
+     * The precision is the resolution of the wheel (RP2040: OPENKNX_TIMERWHEEL_RESOLUTION on the alarm pool
+     * of core0, otherwise the timer interrupt of OPENKNX_INTERRUPT_TIMER_MS). The RP2040 alarm only runs while
+     * timers are scheduled.
+     * Periodic timers keep their phase, missed periods are skipped.
+     */
+    class TimerWheel
+    {
+      private:
+        Timer *_slots[OPENKNX_TIMERWHEEL_SLOTS] = {};
+        Timer *_pendingHead = nullptr;
+        Timer *_pendingTail = nullptr;
+        Timer *_registered = nullptr;
+        uint32_t _tick = 0;
+        uint32_t _tickTime = 0;
+        uint32_t _interruptMax = 0;
+        uint32_t _skipped = 0;
+        SpinLock _lock;
+#ifdef ARDUINO_ARCH_RP2040
+        // the alarm only runs while timers are scheduled
+        uint16_t _scheduled = 0;
+        bool _armed = false;
+        bool arm();
+        void startAlarm();
+#endif
+
+        void insert(Timer &timer);
+        void unlink(Timer &timer);
+        void execute(Timer &timer);
+        void reschedule(Timer &timer, uint32_t now);
+
+      public:
+        void init();
+
+        /*
+         * Schedule a callback. An already scheduled timer is moved. Can be called from both cores and from callbacks.
+         * @param delay in us
+         * @param interval in us for periodic timers, 0 = one shot
+         */
+        void schedule(Timer &timer, uint32_t delay, uint32_t interval = 0);
+
+        /*
+         * Remove the timer from the wheel. A running callback is finished, but not repeated.
+         */
+        void cancel(Timer &timer);
+
+        /*
+         * Advance the wheel and execute the due interrupt callbacks (called by the alarm/timer interrupt)
+         */
+        void interrupt();
+
+#ifdef ARDUINO_ARCH_RP2040
+        /*
+         * Called by the alarm
+         * @return us until the next call (negative = relative to the last call) or 0 to stop
+         */
+        int64_t alarm();
+#endif
+
+        /*
+         * Execute the due loop callbacks (called in the loop of core0)
+         */
+        void loop();
+
+        void showStatus();
+        std::string logPrefix();
+    };
+} // namespace OpenKNX
@@ -0,0 +1,152 @@
+#include "OpenKNX/TransmitQueue.h"
+#include "OpenKNX/Facade.h"
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+
+namespace OpenKNX
+{
+    std::string TransmitQueue::logPrefix()
+    {
+        return "TransmitQueue";
+    }
+
+    bool TransmitQueue::send(GroupObject &ko, const KNXValue &value, const Dpt &type, TransmitPriority priority /* = TransmitPriority::Normal */, uint16_t key /* = 0 */)
+    {
+        ko.valueNoSend(value, type);
+        return send(ko, priority, key);
+    }
+
+    bool TransmitQueue::send(GroupObject &ko, TransmitPriority priority /* = TransmitPriority::Normal */, uint16_t key /* = 0 */)
+    {
+        const uint16_t asap = ko.asap();
+        if (key == 0) key = asap;
+
+        // coalesce - the latest value is sent at the position of the first send
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            if (_entries[i].key != key)
+                continue;
+
+            _entries[i].asap = asap;
+            if (priority < _entries[i].priority)
+                _entries[i].priority = priority;
+            _coalesced++;
+            return true;
+        }
+
+        if (_count >= OPENKNX_TRANSMIT_QUEUE_SIZE)
+        {
+            // replace the latest entry with lower priority
+            int16_t replace = -1;
+            for (uint8_t i = 0; i < _count; i++)
+                if (_entries[i].priority > priority && (replace < 0 || _entries[i].priority >= _entries[replace].priority))
+                    replace = i;
+
+            _dropped++;
+            if (replace < 0)
+                return false;
+
+            remove(replace);
+        }
+
+        Entry &entry = _entries[_count++];
+        entry.queued = millis();
+        entry.asap = asap;
+        entry.key = key;
+        entry.priority = priority;
+        if (_count > _countMax) _countMax = _count;
+        return true;
+    }
+
+    void TransmitQueue::remove(uint8_t index)
+    {
+        _count--;
+        for (uint8_t i = index; i < _count; i++)
+            _entries[i] = _entries[i + 1];
+    }
+
+    /*
+     * @return index of the oldest entry with the highest priority or -1
+     */
+    int16_t TransmitQueue::next()
+    {
+        int16_t found = -1;
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            if (found < 0 || _entries[i].priority < _entries[found].priority)
+                found = i;
+
+            if (_entries[found].priority == TransmitPriority::High)
+                break;
+        }
+        return found;
+    }
+
+    void TransmitQueue::refill()
+    {
+        const uint32_t now = millis();
+        const uint32_t elapsed = now - _lastRefill;
+        if (elapsed == 0)
+            return;
+
+        _lastRefill = now;
+        _tokens = MIN((uint32_t)_burst * 1000, _tokens + MIN(elapsed, 60000) * _rate);
+    }
+
+    bool TransmitQueue::take()
+    {
+        refill();
+        if (_tokens < 1000)
+            return false;
+
+        const int16_t index = next();
+        if (index >= 0 && _entries[index].priority == TransmitPriority::High)
+            return false;
+
+        _tokens -= 1000;
+        return true;
+    }
+
+    void TransmitQueue::setRate(uint16_t telegramsPerSecond, uint8_t burst /* = OPENKNX_TRANSMIT_BURST */)
+    {
+        _rate = MAX(1, telegramsPerSecond);
+        _burst = MAX(1, burst);
+        _tokens = MIN((uint32_t)_burst * 1000, _tokens);
+    }
+
+    uint8_t TransmitQueue::pending()
+    {
+        return _count;
+    }
+
+    void TransmitQueue::loop()
+    {
+        if (_count == 0)
+            return;
+
+        refill();
+        while (_count > 0 && _tokens >= 1000)
+        {
+            const int16_t index = next();
+            const Entry &entry = _entries[index];
+            const uint32_t delay = millis() - entry.queued;
+
+            knx.getGroupObject(entry.asap).objectWritten();
+
+            _tokens -= 1000;
+            _sent++;
+            _delaySum += delay;
+            if (delay > _delayMax) _delayMax = delay;
+            remove(index);
+        }
+    }
+
+    void TransmitQueue::showStatus()
+    {
+        logInfoP("Rate: %u telegrams/s (burst %u)", _rate, _burst);
+        logInfoP("Pending: %u (max %u of %u)", _count, _countMax, OPENKNX_TRANSMIT_QUEUE_SIZE);
+        logInfoP("Sent: %u - Coalesced: %u - Dropped: %u", _sent, _coalesced, _dropped);
+        logInfoP("Delay: avg %ums - max %ums", _sent ? _delaySum / _sent : 0, _delayMax);
+    }
+} // namespace OpenKNX
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+#include "OpenKNX/defines.h"
+#include "knx.h"
+#include <Arduino.h>
+#include <string>
+
+#if (MASK_VERSION & 0x0900) != 0x0900 // Coupler do not have GroupObjects
+
+    #ifndef OPENKNX_TRANSMIT_QUEUE_SIZE
+        #ifdef ARDUINO_ARCH_SAMD
+            #define OPENKNX_TRANSMIT_QUEUE_SIZE 16
+        #else
+            #define OPENKNX_TRANSMIT_QUEUE_SIZE 48
+        #endif
+    #endif
+
+    // telegrams per second sent from the queue
+    #ifndef OPENKNX_TRANSMIT_RATE
+        #define OPENKNX_TRANSMIT_RATE 10
+    #endif
+
+    // telegrams which can be sent at once after an idle time
+    #ifndef OPENKNX_TRANSMIT_BURST
+        #define OPENKNX_TRANSMIT_BURST 5
+    #endif
+
+namespace OpenKNX
+{
+    enum class TransmitPriority : uint8_t
+    {
+        High,
+        Normal,
+        Low
+    };
+
+    /*
+     * Rate limited send of GroupObjects.
+     *
+     * Instead of writing a value directly (which sends a telegram immediately), the value is set without
+     * sending and the send is queued. The queue is drained with OPENKNX_TRANSMIT_RATE telegrams per second
+     * (token bucket with OPENKNX_TRANSMIT_BURST), higher priority first, otherwise in order.
+     * So bursts e.g. after the startup delay are spread over time instead of flooding the line.
+     *
+     * A queued send with the same key (default: the ko number) is coalesced, so only the latest value is sent.
+     *
+     *   openknx.transmit.send(KoMY_Output, value, DPT_Switch);
+     *   openknx.transmit.send(KoMY_Status, TransmitPriority::Low);   // value already set with valueNoSend
+     *
+     * Attention: Only for core0.
+     */
+    class TransmitQueue
+    {
+      private:
+        struct Entry
+        {
+            uint32_t queued;
+            uint16_t asap;
+            uint16_t key;
+            TransmitPriority priority;
+        };
+
+        Entry _entries[OPENKNX_TRANSMIT_QUEUE_SIZE];
+        uint8_t _count = 0;
+        uint32_t _tokens = OPENKNX_TRANSMIT_BURST * 1000; // in 1/1000 telegram
+        uint32_t _lastRefill = 0;
+        uint16_t _rate = OPENKNX_TRANSMIT_RATE;
+        uint8_t _burst = OPENKNX_TRANSMIT_BURST;
+
+        // statistic
+        uint8_t _countMax = 0;
+        uint32_t _sent = 0;
+        uint32_t _coalesced = 0;
+        uint32_t _dropped = 0;
+        uint32_t _delaySum = 0;
+        uint32_t _delayMax = 0;
+
+        void refill();
+        int16_t next();
+        void remove(uint8_t index);
+
+      public:
+        std::string logPrefix();
+
+        /*
+         * Set the value of the ko without sending and queue the send
+         * @return false if the send is dropped because the queue is full
+         */
+        bool send(GroupObject &ko, const KNXValue &value, const Dpt &type, TransmitPriority priority = TransmitPriority::Normal, uint16_t key = 0);
+
+        /*
+         * Queue the send of the current value of the ko
+         * @param key is used for coalescing instead of the ko number, if not 0
+         * @return false if the send is dropped because the queue is full
+         */
+        bool send(GroupObject &ko, TransmitPriority priority = TransmitPriority::Normal, uint16_t key = 0);
+
+        /*
+         * Take one telegram from the budget for a send outside of the queue (e.g. diagnose answers).
+         * @return false if the budget is exhausted or sends with high priority are waiting
+         */
+        bool take();
+
+        void setRate(uint16_t telegramsPerSecond, uint8_t burst = OPENKNX_TRANSMIT_BURST);
+        uint8_t pending();
+
+        /*
+         * Send queued kos as long as the budget allows it. Called by Common::loop after the knx stack.
+         */
+        void loop();
+        void showStatus();
+    };
+} // namespace OpenKNX
+#endif
@@ -25,6 +25,18 @@
     #define OPENKNX_WAIT_FOR_SERIAL 2000
 #endif
 
+#ifndef OPENKNX_HEAP_SAMPLE_INTERVAL // MS
+    #define OPENKNX_HEAP_SAMPLE_INTERVAL 1000
+#endif
+
+#ifndef OPENKNX_STACK_PAINT_RESERVE // Bytes
+    #define OPENKNX_STACK_PAINT_RESERVE 256
+#endif
+
+#ifndef OPENKNX_STACK_PAINT_PATTERN
+    #define OPENKNX_STACK_PAINT_PATTERN 0xDEADBEEF
+#endif
+
 // Priority active?
 #ifdef OPENKNX_HEARTBEAT_PRIO
 
@@ -70,6 +82,18 @@
     #define OPENKNX_RECOVERY_TIME 6000
 #endif
 
+#ifndef OPENKNX_STARTUP_STEP_INTERVAL // MS
+    #define OPENKNX_STARTUP_STEP_INTERVAL 50
+#endif
+
+#ifndef OPENKNX_STARTUP_MAX_DURATION // MS
+    #define OPENKNX_STARTUP_MAX_DURATION 20000
+#endif
+
+#ifndef OPENKNX_STARTUP_JITTER // MS
+    #define OPENKNX_STARTUP_JITTER 2000
+#endif
+
 #ifndef KNX_SERIAL
     #define KNX_SERIAL Serial1
 #endif